@@ -0,0 +1,45 @@
+/**
+ * @file xMemModBench.h
+ * @brief MemoryModule - Общие средства бенчмарков
+ * @details Замер лучшего из нескольких прогонов и вывод строк таблицы.
+ *          Внешних зависимостей нет: бенчмарки собираются вместе с тестами.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace MemoryModule {
+namespace Bench {
+
+// Лучшее время одного прогона (секунды) из repeats повторов
+template <typename Body>
+double BestOf(int repeats, Body&& body) {
+    double best = 1e300;
+    for (int i = 0; i < repeats; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+// Не даёт компилятору выбросить вычисление, результат которого не используется
+template <typename Value>
+inline void Keep(Value value) noexcept {
+    static volatile Value sink;
+    sink = value;
+    static_cast<void>(sink);
+}
+
+} // namespace Bench
+} // namespace MemoryModule
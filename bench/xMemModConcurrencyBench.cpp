@@ -0,0 +1,109 @@
+﻿/**
+ * @file xMemModConcurrencyBench.cpp
+ * @brief MemoryModule - Бенчмарк параллельного поиска экспортов
+ * @details Общая таблица экспортов, 1/2/4/8 потоков ищут имена. Сравниваются
+ *          два способа публикации: прежний (мьютекс на каждый поиск) и
+ *          текущий (атомарный указатель, чтение с acquire, как в
+ *          MemoryModule::GetExportTable). Без блокировки пропускная способность
+ *          растёт с числом ядер, с мьютексом - упирается в одну блокировку.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModBench.h"
+#include "xMemModTest.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace MemoryModule;
+
+namespace {
+
+constexpr size_t kLookupsPerThread = 2000000;
+
+// Поиски из threads потоков одновременно; возвращает млн поисков в секунду
+template <typename Lookup>
+double Run(size_t threads, const std::vector<const char*>& names, Lookup&& lookup) {
+    std::atomic<bool> start(false);
+    std::atomic<size_t> found(0);
+    std::vector<std::thread> workers;
+    
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            
+            size_t hits = 0;
+            size_t position = t * 7919;
+            for (size_t i = 0; i < kLookupsPerThread; ++i) {
+                hits += lookup(names[position % names.size()]) != nullptr;
+                position += 13;
+            }
+            found.fetch_add(hits, std::memory_order_relaxed);
+        });
+    }
+    
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    
+    Bench::Keep(found.load());
+    return threads * kLookupsPerThread / elapsed.count() / 1e6;
+}
+
+} // namespace
+
+int main() {
+    std::vector<Test::SyntheticExport> exports = Test::NumberedExports(4096);
+    Test::SyntheticImage image(exports);
+    ExportDirectory directory;
+    
+    ExportTable table;
+    if (!image.ReadDirectory(directory) || !table.Build(directory)) {
+        fprintf(stderr, "синтетическая таблица не построена\n");
+        return 1;
+    }
+    
+    std::vector<const char*> names;
+    for (const auto& entry : exports) {
+        names.push_back(entry.name.c_str());
+    }
+    
+    // Прежняя схема: каждый поиск под мьютексом модуля
+    std::mutex mutex;
+    auto locked = [&](const char* name) -> const void* {
+        std::lock_guard<std::mutex> lock(mutex);
+        UInt32 slot = table.index.Find(name);
+        return slot != ExportIndex::kNotFound ? table.AddressAt(slot) : nullptr;
+    };
+    
+    // Текущая схема: одна загрузка указателя с acquire
+    std::atomic<const ExportTable*> published(&table);
+    auto lock_free = [&](const char* name) -> const void* {
+        const ExportTable* current = published.load(std::memory_order_acquire);
+        UInt32 slot = current->index.Find(name);
+        return slot != ExportIndex::kNotFound ? current->AddressAt(slot) : nullptr;
+    };
+    
+    printf("ядер: %u\n", std::thread::hardware_concurrency());
+    // Ширина с поправкой на двухбайтовую кириллицу в UTF-8
+    printf("%14s %17s %26s\n", "потоков", "мьютекс", "без блокировки");
+    
+    for (size_t threads : {1u, 2u, 4u, 8u}) {
+        double with_mutex = Run(threads, names, locked);
+        double without = Run(threads, names, lock_free);
+        printf("%7zu %10.1f %14.1f  млн поисков/с\n", threads, with_mutex, without);
+    }
+    
+    return 0;
+}
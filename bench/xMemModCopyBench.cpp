@@ -0,0 +1,64 @@
+﻿/**
+ * @file xMemModCopyBench.cpp
+ * @brief MemoryModule - Бенчмарк копирования секций
+ * @details Пропускная способность memcpy, StreamCopy и CopyRegions (куски
+ *          на потоках) для секций от 256 КБ до 256 МБ. Приёмник выделяется
+ *          на каждом прогоне заново; крупные приёмники (mmap) приходят с
+ *          неотображёнными страницами, как при загрузке модуля.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModBench.h"
+#include "xMemModCopy.h"
+#include "xMemModTypes.h"
+
+#include <cstring>
+#include <memory>
+
+using namespace MemoryModule;
+
+namespace {
+
+// ГБ/с лучшего прогона копирования size байт в свежий приёмник
+template <typename Copy>
+double Throughput(size_t size, const UInt8* source, Copy&& copy) {
+    double seconds = Bench::BestOf(5, [&] {
+        std::unique_ptr<UInt8[]> target(new UInt8[size]);
+        copy(target.get(), source, size);
+        Bench::Keep(target[size / 2]);
+    });
+    return size / seconds / 1e9;
+}
+
+} // namespace
+
+int main() {
+    const size_t kMaxSize = 256u << 20;
+    std::unique_ptr<UInt8[]> source(new UInt8[kMaxSize]);
+    memset(source.get(), 0x5A, kMaxSize);
+    
+    // Ширина с поправкой на двухбайтовую кириллицу в UTF-8
+    printf("%14s %10s %12s %14s\n", "секция, КБ", "memcpy", "StreamCopy", "CopyRegions");
+    
+    for (size_t size : {256u << 10, 4u << 20, 16u << 20, 64u << 20, 256u << 20}) {
+        double plain = Throughput(size, source.get(), [](UInt8* target, const UInt8* from, size_t bytes) {
+            memcpy(target, from, bytes);
+        });
+        double streaming = Throughput(size, source.get(), [](UInt8* target, const UInt8* from, size_t bytes) {
+            StreamCopy(target, from, bytes);
+        });
+        double regions = Throughput(size, source.get(), [](UInt8* target, const UInt8* from, size_t bytes) {
+            CopyRegion region{target, from, bytes};
+            CopyRegions(&region, 1, CopyOptions());
+        });
+        
+        printf("%10zu %10.2f %12.2f %14.2f  ГБ/с\n", size >> 10, plain, streaming, regions);
+    }
+    
+    return 0;
+}
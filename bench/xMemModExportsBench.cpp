@@ -0,0 +1,41 @@
+﻿/**
+ * @file xMemModExportsBench.cpp
+ * @brief MemoryModule - Бенчмарк построения индекса экспортов
+ * @details Время ExportIndex::Build для 1k/10k/100k имён при 1/4/8 потоках.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModBench.h"
+#include "xMemModTest.h"
+
+using namespace MemoryModule;
+
+int main() {
+    // Ширина с поправкой на двухбайтовую кириллицу в UTF-8
+    printf("%10s %8s %14s %19s\n", "exports", "workers", "build, мс", "имён/с");
+    
+    for (UInt32 count : {1000u, 10000u, 100000u}) {
+        Test::SyntheticImage image(Test::NumberedExports(count));
+        ExportDirectory directory;
+        if (!image.ReadDirectory(directory)) {
+            fprintf(stderr, "синтетический каталог не прочитан\n");
+            return 1;
+        }
+        
+        for (UInt32 workers : {1u, 4u, 8u}) {
+            ExportIndex index;
+            double seconds = Bench::BestOf(20, [&] {
+                index.Build(directory, workers);
+                Bench::Keep(index.Size());
+            });
+            printf("%10u %8u %12.3f %14.0f\n", count, workers, seconds * 1e3, count / seconds);
+        }
+    }
+    
+    return 0;
+}
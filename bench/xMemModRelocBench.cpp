@@ -0,0 +1,67 @@
+﻿/**
+ * @file xMemModRelocBench.cpp
+ * @brief MemoryModule - Бенчмарк применения базовых релокаций
+ * @details Записей в секунду для образа 64 МБ при разной плотности DIR64 на
+ *          страницу: скалярный проход, SIMD-ядро и ApplyRelocations на потоках.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModBench.h"
+#include "xMemModReloc.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace MemoryModule;
+
+int main() {
+    const UInt32 kPageSize = 0x1000;
+    const UInt32 kPages = 16384;
+    const UInt64 kDelta = 0x10000;
+    
+    // Ширина с поправкой на двухбайтовую кириллицу в UTF-8
+    printf("%25s %22s %14s %20s\n", "записей/стр.", "скалярно", "SIMD", "потоки+SIMD");
+    
+    for (UInt32 density : {4u, 16u, 64u, 256u, 512u}) {
+        // Образ, за ним таблица: страница -> density записей DIR64 через 8 байт
+        std::vector<UInt8> table;
+        for (UInt32 page = 0; page < kPages; ++page) {
+            UInt32 header[2] = {page * kPageSize, 8 + 2 * density};
+            table.insert(table.end(), reinterpret_cast<UInt8*>(header), reinterpret_cast<UInt8*>(header + 2));
+            for (UInt32 i = 0; i < density; ++i) {
+                UInt16 entry = static_cast<UInt16>(RelocationType::kDir64 << 12 | (i * (kPageSize / density) & 0xFF8));
+                table.insert(table.end(), reinterpret_cast<UInt8*>(&entry), reinterpret_cast<UInt8*>(&entry + 1));
+            }
+        }
+        
+        size_t image_size = static_cast<size_t>(kPages) * kPageSize + kPageSize + table.size();
+        std::vector<UInt8> image(image_size, 0x11);
+        UInt32 table_rva = (kPages + 1) * kPageSize;
+        memcpy(&image[table_rva], table.data(), table.size());
+        
+        std::vector<RelocationBlock> blocks;
+        IndexRelocationBlocks(table.data(), table.size(), blocks);
+        
+        double fixups = static_cast<double>(kPages) * density;
+        double scalar = Bench::BestOf(5, [&] {
+            ApplyRelocationBlocks(image.data(), image.size(), table.data(), blocks.data(), blocks.size(), kDelta, false);
+        });
+        double vectorized = Bench::BestOf(5, [&] {
+            ApplyRelocationBlocks(image.data(), image.size(), table.data(), blocks.data(), blocks.size(), kDelta, true);
+        });
+        double parallel = Bench::BestOf(5, [&] {
+            ApplyRelocations(image.data(), image.size(), table_rva, static_cast<UInt32>(table.size()), kDelta,
+                             RelocationOptions());
+        });
+        
+        printf("%15u %14.1f %14.1f %14.1f  млн/с\n", density, fixups / scalar / 1e6, fixups / vectorized / 1e6,
+               fixups / parallel / 1e6);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,176 @@
+﻿/**
+ * @file xMemModRssBench.cpp
+ * @brief MemoryModule - Бенчмарк памяти при загрузке из файла (только Linux)
+ * @details Сравнивает две схемы LoadFromFile на образе 64 МБ, выложенном в
+ *          файле по RVA: чтение файла в буфер и копирование в SizeOfImage
+ *          (как LoadFromMemory) против отображения с копированием при записи
+ *          (mmap MAP_PRIVATE - аналог FILE_MAP_COPY в загрузчике). В обеих
+ *          схемах применяются релокации части страниц и читается весь образ.
+ *          RssAnon/RssFile берутся из /proc/self/status.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModBench.h"
+#include "xMemModReloc.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace MemoryModule;
+
+namespace {
+
+constexpr size_t kPageSize = 4096;
+constexpr size_t kImageSize = 64u << 20;
+constexpr size_t kRelocatedPageStep = 20;  // Релокации на каждой 20-й странице (5%)
+constexpr UInt64 kDelta = 0x10000;
+
+// Резидентная память процесса, КБ
+struct Rss {
+    long anon = 0;
+    long file = 0;
+};
+
+Rss ReadRss() {
+    Rss rss;
+    FILE* status = fopen("/proc/self/status", "r");
+    if (!status) {
+        return rss;
+    }
+    
+    char line[256];
+    while (fgets(line, sizeof(line), status)) {
+        sscanf(line, "RssAnon: %ld", &rss.anon);
+        sscanf(line, "RssFile: %ld", &rss.file);
+    }
+    fclose(status);
+    return rss;
+}
+
+// Вывод с выравниванием влево по числу символов, а не байтов UTF-8
+void PrintPadded(const char* text, size_t width) {
+    size_t characters = 0;
+    for (const char* c = text; *c; ++c) {
+        characters += (*c & 0xC0) != 0x80;
+    }
+    printf("%s%*s", text, static_cast<int>(width > characters ? width - characters : 0), "");
+}
+
+void Report(const char* stage, const Rss& before, const Rss& after, double seconds) {
+    PrintPadded(stage, 40);
+    printf(" %12ld %12ld %8.1f\n", (after.anon - before.anon) >> 10, (after.file - before.file) >> 10,
+           seconds * 1e3);
+}
+
+// Таблица релокаций: 64 записи DIR64 на каждой kRelocatedPageStep-й странице
+std::vector<UInt8> BuildRelocations() {
+    std::vector<UInt8> table;
+    for (size_t page = 0; page < kImageSize / kPageSize; page += kRelocatedPageStep) {
+        UInt32 header[2] = {static_cast<UInt32>(page * kPageSize), 8 + 2 * 64};
+        table.insert(table.end(), reinterpret_cast<UInt8*>(header), reinterpret_cast<UInt8*>(header + 2));
+        for (UInt32 i = 0; i < 64; ++i) {
+            UInt16 entry = static_cast<UInt16>(RelocationType::kDir64 << 12 | i * 64);
+            table.insert(table.end(), reinterpret_cast<UInt8*>(&entry), reinterpret_cast<UInt8*>(&entry + 1));
+        }
+    }
+    return table;
+}
+
+// Релокации и чтение каждой страницы (как исполнение кода)
+void Relocate(UInt8* image, const std::vector<UInt8>& table) {
+    std::vector<RelocationBlock> blocks;
+    IndexRelocationBlocks(table.data(), table.size(), blocks);
+    ApplyRelocationBlocks(image, kImageSize, table.data(), blocks.data(), blocks.size(), kDelta);
+    
+    UInt64 sum = 0;
+    for (size_t offset = 0; offset < kImageSize; offset += kPageSize) {
+        sum += image[offset + 100];
+    }
+    Bench::Keep(sum);
+}
+
+} // namespace
+
+int main() {
+    const char* directory = getenv("TMPDIR");
+    std::string path = std::string(directory ? directory : "/tmp") + "/xMemModRssBench.XXXXXX";
+    int fd = mkstemp(&path[0]);
+    if (fd < 0) {
+        fprintf(stderr, "не удалось создать временный файл\n");
+        return 1;
+    }
+    unlink(path.c_str());
+    
+    // Файл-образ: ненулевое содержимое, чтобы не попасть на общую нулевую страницу
+    {
+        std::vector<UInt8> page(kPageSize);
+        for (size_t offset = 0; offset < kImageSize; offset += kPageSize) {
+            memset(page.data(), static_cast<int>(offset / kPageSize % 251 + 1), kPageSize);
+            if (write(fd, page.data(), kPageSize) != static_cast<ssize_t>(kPageSize)) {
+                fprintf(stderr, "не удалось записать временный файл\n");
+                return 1;
+            }
+        }
+    }
+    
+    std::vector<UInt8> table = BuildRelocations();
+    
+    printf("образ %zu МБ, релокации на %zu%% страниц\n", kImageSize >> 20, 100 / kRelocatedPageStep);
+    PrintPadded("этап", 40);
+    // Ширина с поправкой на двухбайтовую кириллицу в UTF-8
+    printf(" %14s %14s %10s\n", "RssAnon, МБ", "RssFile, МБ", "мс");
+    
+    // Чтение в буфер и копирование: образ оплачивается дважды во время загрузки
+    {
+        Rss before = ReadRss();
+        auto start = std::chrono::steady_clock::now();
+        
+        std::unique_ptr<UInt8[]> file(new UInt8[kImageSize]);
+        if (pread(fd, file.get(), kImageSize, 0) != static_cast<ssize_t>(kImageSize)) {
+            fprintf(stderr, "не удалось прочитать временный файл\n");
+            return 1;
+        }
+        std::unique_ptr<UInt8[]> image(new UInt8[kImageSize]);
+        memcpy(image.get(), file.get(), kImageSize);
+        Relocate(image.get(), table);
+        
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        Report("read + copy: во время загрузки", before, ReadRss(), elapsed.count());
+        
+        file.reset();
+        Report("read + copy: после освобождения буфера", before, ReadRss(), elapsed.count());
+    }
+    
+    // Отображение с копированием при записи: частными становятся только
+    // страницы с релокациями, остальные общие со страничным кэшем
+    {
+        Rss before = ReadRss();
+        auto start = std::chrono::steady_clock::now();
+        
+        void* view = mmap(nullptr, kImageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            fprintf(stderr, "mmap не удался\n");
+            return 1;
+        }
+        Relocate(static_cast<UInt8*>(view), table);
+        
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        Report("mmap MAP_PRIVATE", before, ReadRss(), elapsed.count());
+        munmap(view, kImageSize);
+    }
+    
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,107 @@
+﻿/**
+ * @file xMemModThunksBench.cpp
+ * @brief MemoryModule - Бенчмарк накладных расходов переходников
+ * @details Время вызова через переходник x64 со счётчиком против прямого
+ *          косвенного вызова и вызова с общим атомарным счётчиком (одна
+ *          строка кэша на все потоки), для 1/2/4/8 потоков. Только x86-64 с mmap.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModBench.h"
+#include "xMemModThunks.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace MemoryModule;
+
+namespace {
+
+constexpr size_t kCallsPerThread = 20000000;
+
+using Function = int (*)(int);
+
+__attribute__((noinline)) int Target(int value) {
+    return value + 1;
+}
+
+std::atomic<UInt64> g_shared_counter(0);
+
+// Прежний вариант без полос: один счётчик на все потоки
+__attribute__((noinline)) int SharedCounted(int value) {
+    g_shared_counter.fetch_add(1, std::memory_order_relaxed);
+    return Target(value);
+}
+
+// Наносекунд на вызов в каждом потоке: threads потоков по kCallsPerThread
+// вызовов одновременно (при числе потоков больше числа ядер время растёт
+// уже из-за разделения ядер)
+double NanosecondsPerCall(size_t threads, Function function) {
+    std::atomic<bool> start(false);
+    std::vector<std::thread> workers;
+    
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&start, function] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            
+            // volatile - компилятор не видит цель и не встраивает вызов
+            volatile Function call = function;
+            int value = 0;
+            for (size_t i = 0; i < kCallsPerThread; ++i) {
+                value = call(value);
+            }
+            Bench::Keep(value);
+        });
+    }
+    
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    return elapsed.count() * 1e9 / kCallsPerThread;
+}
+
+} // namespace
+
+int main() {
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t size = CallCounters::RequiredSize(1, page);
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    
+    const void* targets[] = {reinterpret_cast<const void*>(&Target)};
+    CallCounters counters;
+    if (memory == MAP_FAILED || !counters.Build(memory, size, page, targets, 1, ThunkArch::X64) ||
+        mprotect(memory, CallCounters::CodeSize(1, page), PROT_READ | PROT_EXEC) != 0) {
+        fprintf(stderr, "не удалось подготовить переходник\n");
+        return 1;
+    }
+    auto thunk = reinterpret_cast<Function>(const_cast<void*>(counters.ThunkAt(0)));
+    
+    printf("ядер: %u\n", std::thread::hardware_concurrency());
+    // Ширина с поправкой на двухбайтовую кириллицу в UTF-8
+    printf("%14s %18s %28s %32s\n", "потоков", "напрямую", "переходник", "общий счётчик");
+    
+    for (size_t threads : {1u, 2u, 4u, 8u}) {
+        double direct = NanosecondsPerCall(threads, &Target);
+        double through_thunk = NanosecondsPerCall(threads, thunk);
+        double shared = NanosecondsPerCall(threads, &SharedCounted);
+        printf("%7zu %10.2f %18.2f %20.2f  нс/вызов\n", threads, direct, through_thunk, shared);
+    }
+    
+    Bench::Keep(counters.CountAt(0));
+    munmap(memory, size);
+    return 0;
+}
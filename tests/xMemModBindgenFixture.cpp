@@ -0,0 +1,57 @@
+﻿/**
+ * @file xMemModBindgenFixture.cpp
+ * @brief MemoryModule - Образ и сигнатуры для теста генератора привязок
+ * @details Пишет PE-файл с экспортами, имена которых совпадают с ключевыми
+ *          словами C++, макросами и именами внутри сгенерированной структуры
+ *          Api, и файл сигнатур к нему. Сборка теста прогоняет по ним
+ *          xMemModBindgen и компилирует полученный заголовок.
+ *
+ *          Использование: xMemModBindgenFixture <image.dll> <signatures>
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModTest.h"
+
+#include <fstream>
+
+using namespace MemoryModule;
+
+// Экспорты по порядку ординалов (база 1); xMemModBindgenTest.cpp проверяет
+// идентификаторы, которые генератор выдаёт для каждого из них
+const char* const kExportNames[] = {
+    "complete", "module", "address", "ordinal", "target",
+    "Bind", "Api", "BindOne", "Types", "Ordinals", "kFingerprint", "Module", "Function", "MemoryModule",
+    "mutable", "decltype", "typeid", "xor", "static_cast", "thread_local", "char8_t", "co_await",
+    "module_", "complete_", "min", "NULL",
+    "?Init@@YAHXZ", "__stdcall_name", "1st", "a.b", "a_b",
+    "",  // Только по ординалу
+};
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "Использование: xMemModBindgenFixture <image.dll> <signatures>\n");
+        return 2;
+    }
+    
+    std::vector<Test::SyntheticExport> exports;
+    for (const char* name : kExportNames) {
+        exports.push_back(Test::SyntheticExport{name, 0x2000 + 16 * static_cast<UInt32>(exports.size()), {}});
+    }
+    
+    std::vector<UInt8> file = Test::SyntheticImage(exports).PeFile(0x5F000000u, 0x1234);
+    std::ofstream image(argv[1], std::ios::binary);
+    image.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+    
+    std::ofstream signatures(argv[2]);
+    signatures << "# Сигнатуры по именам в образе\n"
+               << "complete = int(int value)\n"
+               << "mutable = void(const char* text)\n"
+               << "module_ = double()\n";
+    
+    return image && signatures ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+﻿/**
+ * @file xMemModBindgenTest.cpp
+ * @brief MemoryModule - Тест генератора привязок
+ * @details BindgenFixture.h генерируется при сборке из образа
+ *          xMemModBindgenFixture: то, что он вообще компилируется, - основная
+ *          проверка. Дальше Api::Bind заполняется через поддельный модуль.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModTest.h"
+#include "BindgenFixture.h"
+
+#include <type_traits>
+
+using namespace MemoryModule;
+
+namespace {
+
+// "Код" экспортов: адрес = &g_code[ординал]
+char g_code[64];
+
+// Модуль с интерфейсом, который ожидает сгенерированный Bind
+struct FakeModule {
+    UInt64 key;
+    UInt32 missing_ordinal;
+    
+    UInt64 GetExportIndexKey() const noexcept { return key; }
+    void* GetProcAddressByOrdinal(UInt32 ordinal) const noexcept {
+        return ordinal == missing_ordinal || ordinal >= sizeof(g_code) ? nullptr : &g_code[ordinal];
+    }
+};
+
+template <typename Function>
+bool BoundTo(Function* pointer, UInt32 ordinal) {
+    return reinterpret_cast<void*>(pointer) == &g_code[ordinal];
+}
+
+// Сигнатуры из файла применены, остальные - void()
+static_assert(std::is_same<BindgenFixture::Types::complete, int(int)>::value, "signature of complete");
+static_assert(std::is_same<BindgenFixture::Types::mutable_, void(const char*)>::value, "signature of mutable");
+static_assert(std::is_same<BindgenFixture::Types::module_1, double()>::value, "signature of module_");
+static_assert(std::is_same<BindgenFixture::Types::Bind_, void()>::value, "default signature");
+
+void TestBind() {
+    namespace Ordinals = BindgenFixture::Ordinals;
+    
+    // Чужой отпечаток - ничего не заполняется
+    BindgenFixture::Api api;
+    FakeModule stale{BindgenFixture::kFingerprint ^ 1, 0};
+    XMEMMOD_CHECK(!api.Bind(stale));
+    XMEMMOD_CHECK(api.complete == nullptr && api.module == nullptr);
+    
+    FakeModule module{BindgenFixture::kFingerprint, 0};
+    XMEMMOD_CHECK(api.Bind(module));
+    
+    // Имена, совпадающие с локальными переменными и параметрами Bind
+    XMEMMOD_CHECK(Ordinals::complete == 1 && BoundTo(api.complete, 1));
+    XMEMMOD_CHECK(Ordinals::module == 2 && BoundTo(api.module, 2));
+    XMEMMOD_CHECK(BoundTo(api.address, Ordinals::address));
+    XMEMMOD_CHECK(BoundTo(api.ordinal, Ordinals::ordinal));
+    XMEMMOD_CHECK(BoundTo(api.target, Ordinals::target));
+    XMEMMOD_CHECK(BoundTo(api.module_1, 23) && BoundTo(api.complete_1, 24));
+    
+    // Имена сгенерированной области видимости и ключевые слова
+    XMEMMOD_CHECK(BoundTo(api.Bind_, 6) && BoundTo(api.Api_, 7) && BoundTo(api.BindOne_, 8));
+    XMEMMOD_CHECK(BoundTo(api.Types_, 9) && BoundTo(api.Ordinals_, 10) && BoundTo(api.kFingerprint_, 11));
+    XMEMMOD_CHECK(BoundTo(api.Module_, 12) && BoundTo(api.Function_, 13) && BoundTo(api.MemoryModule_, 14));
+    XMEMMOD_CHECK(BoundTo(api.mutable_, 15) && BoundTo(api.decltype_, 16) && BoundTo(api.typeid_, 17));
+    XMEMMOD_CHECK(BoundTo(api.xor_, 18) && BoundTo(api.static_cast_, 19) && BoundTo(api.thread_local_, 20));
+    XMEMMOD_CHECK(BoundTo(api.char8_t_, 21) && BoundTo(api.co_await_, 22));
+    XMEMMOD_CHECK(BoundTo(api.min_, 25) && BoundTo(api.NULL_, 26));
+    
+    // Декорированные, с "__", с цифрой в начале, совпавшие после замены символов
+    XMEMMOD_CHECK(BoundTo(api.Init_YAHXZ, 27) && BoundTo(api._stdcall_name, 28) && BoundTo(api._1st, 29));
+    XMEMMOD_CHECK(BoundTo(api.a_b, 30) && BoundTo(api.a_b_2, 31));
+    XMEMMOD_CHECK(BoundTo(api.Ordinal_32, 32));
+    
+    // Ненайденный экспорт: Bind сообщает о неполной привязке
+    BindgenFixture::Api partial;
+    FakeModule incomplete{BindgenFixture::kFingerprint, Ordinals::xor_};
+    XMEMMOD_CHECK(!partial.Bind(incomplete));
+    XMEMMOD_CHECK(partial.xor_ == nullptr && BoundTo(partial.Ordinal_32, 32));
+}
+
+} // namespace
+
+int main() {
+    TestBind();
+    return Test::Finish("xMemModBindgenTest");
+}
@@ -0,0 +1,101 @@
+﻿/**
+ * @file xMemModCopyTest.cpp
+ * @brief MemoryModule - Тесты копирования секций
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModTest.h"
+#include "xMemModCopy.h"
+
+using namespace MemoryModule;
+
+namespace {
+
+constexpr UInt8 kGuard = 0xCD;
+
+void Fill(std::vector<UInt8>& bytes, UInt32 seed) {
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        bytes[i] = static_cast<UInt8>(seed >> 24);
+    }
+}
+
+// Приёмник совпадает с источником, байты вокруг не тронуты
+bool CopiedExactly(const std::vector<UInt8>& target, size_t offset, const UInt8* source, size_t size) {
+    for (size_t i = 0; i < target.size(); ++i) {
+        bool inside = i >= offset && i < offset + size;
+        if (target[i] != (inside ? source[i - offset] : kGuard)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Потоковое копирование при любых размерах и смещениях обоих указателей
+void TestStreamCopy() {
+    std::vector<UInt8> source(1u << 20);
+    Fill(source, 1);
+    
+    std::vector<UInt8> target;
+    for (size_t size = 0; size <= 300; ++size) {
+        for (size_t destination_offset = 0; destination_offset < 16; ++destination_offset) {
+            for (size_t source_offset = 0; source_offset < 16; source_offset += 5) {
+                target.assign(size + 64, kGuard);
+                StreamCopy(target.data() + destination_offset, source.data() + source_offset, size);
+                XMEMMOD_CHECK(CopiedExactly(target, destination_offset, source.data() + source_offset, size));
+            }
+        }
+    }
+    
+    for (size_t size : {size_t(4096), size_t(65536 + 13), source.size() - 7}) {
+        target.assign(size + 32, kGuard);
+        StreamCopy(target.data() + 3, source.data() + 7, size);
+        XMEMMOD_CHECK(CopiedExactly(target, 3, source.data() + 7, size));
+    }
+}
+
+// Набор областей: куски по страницам приёмника, на потоках и без них
+void TestCopyRegions() {
+    const size_t sizes[] = {0, 1, 4095, 4096, 20000, 100000, 300001};
+    
+    for (size_t workers : {size_t(1), size_t(4), size_t(0)}) {
+        CopyOptions options;
+        options.parallel_threshold = 64u << 10;
+        options.streaming_threshold = 16u << 10;
+        options.chunk_size = 3 * 4096 + 100;  // Округляется до страниц
+        options.max_workers = workers;
+        
+        std::vector<std::vector<UInt8>> sources;
+        std::vector<std::vector<UInt8>> targets;
+        std::vector<CopyRegion> regions;
+        for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+            sources.emplace_back(sizes[i] + 16);
+            Fill(sources.back(), static_cast<UInt32>(i + 10));
+            targets.emplace_back(sizes[i] + 64, kGuard);
+        }
+        for (size_t i = 0; i < targets.size(); ++i) {
+            regions.push_back(CopyRegion{targets[i].data() + 1 + i % 7, sources[i].data() + i % 5, sizes[i]});
+        }
+        
+        CopyRegions(regions.data(), regions.size(), options);
+        
+        for (size_t i = 0; i < targets.size(); ++i) {
+            XMEMMOD_CHECK(CopiedExactly(targets[i], 1 + i % 7, sources[i].data() + i % 5, sizes[i]));
+        }
+    }
+    
+    CopyRegions(nullptr, 0, CopyOptions());
+}
+
+} // namespace
+
+int main() {
+    TestStreamCopy();
+    TestCopyRegions();
+    return Test::Finish("xMemModCopyTest");
+}
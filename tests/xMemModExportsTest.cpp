@@ -0,0 +1,340 @@
+﻿/**
+ * @file xMemModExportsTest.cpp
+ * @brief MemoryModule - Тесты хеш-индекса экспортов
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModTest.h"
+
+#include <random>
+
+using namespace MemoryModule;
+
+namespace {
+
+// Аппаратный хеш совпадает с табличным для любых длин и выравниваний
+void TestHashFastMatchesHash() {
+    std::mt19937 random(12345);
+    std::vector<char> buffer(128);
+    
+    for (int round = 0; round < 4000; ++round) {
+        size_t offset = random() % 8;
+        size_t length = random() % (buffer.size() - offset);
+        for (size_t i = 0; i < offset + length; ++i) {
+            buffer[i] = static_cast<char>(random() % 255 + 1);
+        }
+        
+        const char* name = buffer.data() + offset;
+        XMEMMOD_CHECK(SymbolHash::HashFast(name, length) == SymbolHash::Hash(name, length));
+    }
+    
+    XMEMMOD_CHECK(SymbolHash::HashFast("", 0) == SymbolHash::Hash("", 0));
+    
+    // Ключ, посчитанный при компиляции, равен хешу во время выполнения
+    static constexpr SymbolKey kInit("Init");
+    static_assert(kInit.length == 4, "SymbolKey length");
+    XMEMMOD_CHECK(kInit.hash == SymbolHash::HashFast("Init", 4));
+}
+
+// Поиск имён, отсутствующих имён и экспортов только по ординалу
+void TestIndexLookup() {
+    std::vector<Test::SyntheticExport> exports = Test::NumberedExports(1000);
+    exports[10].name.clear();   // только по ординалу
+    exports[20].rva = 0;        // пустая ячейка
+    
+    Test::SyntheticImage image(exports, 5);
+    ExportDirectory directory;
+    XMEMMOD_CHECK(image.ReadDirectory(directory));
+    
+    ExportIndex index;
+    XMEMMOD_CHECK(index.Build(directory));
+    XMEMMOD_CHECK(index.Size() == 999);
+    
+    for (UInt32 i = 0; i < exports.size(); ++i) {
+        if (exports[i].name.empty()) {
+            continue;
+        }
+        
+        UInt32 slot = index.Find(exports[i].name.c_str());
+        if (XMEMMOD_CHECK(slot != ExportIndex::kNotFound)) {
+            XMEMMOD_CHECK(index.FunctionIndexAt(slot) == i);
+            XMEMMOD_CHECK(std::string(index.NameAt(slot), index.NameLengthAt(slot)) == exports[i].name);
+        }
+    }
+    
+    XMEMMOD_CHECK(index.Find("Function_") == ExportIndex::kNotFound);
+    XMEMMOD_CHECK(index.Find("Function_1000") == ExportIndex::kNotFound);
+    XMEMMOD_CHECK(index.Find("function_1") == ExportIndex::kNotFound);
+    XMEMMOD_CHECK(index.Find(static_cast<const char*>(nullptr)) == ExportIndex::kNotFound);
+    
+    // Пакетный поиск отвечает так же, как поиск по одному
+    const char* names[] = {"Function_0", "Missing", "Function_999", "Function_10"};
+    UInt32 slots[4];
+    index.FindMany(names, slots, 4);
+    for (size_t i = 0; i < 4; ++i) {
+        XMEMMOD_CHECK(slots[i] == index.Find(names[i]));
+    }
+    
+    // Таблица ординалов покрывает и экспорт без имени
+    ExportTable table;
+    XMEMMOD_CHECK(table.Build(directory));
+    XMEMMOD_CHECK(table.ordinals.Find(5 + 10) != nullptr);
+    XMEMMOD_CHECK(table.ordinals.Find(5 + 20) == nullptr);
+    XMEMMOD_CHECK(table.ordinals.Find(4) == nullptr);
+}
+
+// Поиск по таблице имён без индекса: двоичный поиск совпадает с линейным,
+// порядок таблицы проверяется один раз и запоминается
+void TestNameTableSearch() {
+    auto find = [](const ExportDirectory& directory, const char* name, NameOrder& order) {
+        return directory.FindName(name, strlen(name), order);
+    };
+    auto linear = [](const ExportDirectory& directory, const char* name) {
+        return directory.FindNameLinear(name, strlen(name));
+    };
+    
+    // Отсортированная таблица с повторяющимся именем: первое из повторов
+    std::vector<Test::SyntheticExport> exports = Test::NumberedExports(200);
+    std::vector<Test::SyntheticAlias> aliases;
+    for (UInt16 i = 0; i < 5; ++i) {
+        aliases.push_back(Test::SyntheticAlias{"Function_150", static_cast<UInt16>(i * 10)});
+    }
+    
+    Test::SyntheticImage sorted_image(exports, 1, aliases);
+    ExportDirectory sorted;
+    XMEMMOD_CHECK(sorted_image.ReadDirectory(sorted));
+    XMEMMOD_CHECK(sorted.IsNameTableSorted());
+    
+    for (const char* name : {"Function_0", "Function_150", "Function_199", "Function_99"}) {
+        bool violation = false;
+        XMEMMOD_CHECK(sorted.FindNameBinary(name, strlen(name), &violation) == linear(sorted, name));
+        XMEMMOD_CHECK(!violation);
+        
+        NameOrder order = NameOrder::Unknown;
+        XMEMMOD_CHECK(find(sorted, name, order) == linear(sorted, name));
+        XMEMMOD_CHECK(order == NameOrder::Unknown);  // попадание порядок не проверяет
+    }
+    
+    // Промах при неизвестном порядке проверяет таблицу и запоминает результат
+    NameOrder order = NameOrder::Unknown;
+    XMEMMOD_CHECK(find(sorted, "Function_200", order) == ExportIndex::kNotFound);
+    XMEMMOD_CHECK(order == NameOrder::Sorted);
+    XMEMMOD_CHECK(find(sorted, "Function_", order) == ExportIndex::kNotFound);
+    XMEMMOD_CHECK(order == NameOrder::Sorted);
+    
+    // Таблица в обратном порядке: двоичный поиск видит нарушение порядка,
+    // и FindName переходит на линейный
+    std::reverse(exports.begin(), exports.end());
+    Test::SyntheticImage reversed_image(exports, 1, {}, false);
+    ExportDirectory reversed;
+    XMEMMOD_CHECK(reversed_image.ReadDirectory(reversed));
+    XMEMMOD_CHECK(!reversed.IsNameTableSorted());
+    
+    order = NameOrder::Unknown;
+    for (const auto& entry : exports) {
+        XMEMMOD_CHECK(find(reversed, entry.name.c_str(), order) == linear(reversed, entry.name.c_str()));
+    }
+    XMEMMOD_CHECK(order == NameOrder::Unsorted);
+    XMEMMOD_CHECK(find(reversed, "Missing", order) == ExportIndex::kNotFound);
+    
+    // Одно имя не на месте в конце: двоичный поиск промахивается, не заметив
+    // нарушения. Запомненный Sorted ему доверяет, Unknown - проверяет таблицу
+    std::vector<Test::SyntheticExport> tail = {{"B", 0x2000, {}}, {"C", 0x2010, {}}, {"D", 0x2020, {}}, {"A", 0x2030, {}}};
+    Test::SyntheticImage tail_image(tail, 1, {}, false);
+    ExportDirectory misplaced;
+    XMEMMOD_CHECK(tail_image.ReadDirectory(misplaced));
+    
+    bool violation = false;
+    XMEMMOD_CHECK(misplaced.FindNameBinary("A", 1, &violation) == ExportIndex::kNotFound);
+    XMEMMOD_CHECK(!violation);
+    
+    order = NameOrder::Sorted;
+    XMEMMOD_CHECK(find(misplaced, "A", order) == ExportIndex::kNotFound);
+    XMEMMOD_CHECK(order == NameOrder::Sorted);
+    
+    order = NameOrder::Unknown;
+    XMEMMOD_CHECK(find(misplaced, "A", order) == 3);
+    XMEMMOD_CHECK(order == NameOrder::Unsorted);
+    XMEMMOD_CHECK(find(misplaced, "C", order) == 1);
+}
+
+// Обратный поиск адрес -> экспорт: без пустых ячеек, RVA 0 и форвардеров,
+// именованный экспорт среди псевдонимов, размер до следующего экспорта
+void TestAddressLookup() {
+    std::vector<Test::SyntheticExport> exports = {
+        {{}, 0x3000, {}},            // только по ординалу, тот же RVA, что у Alpha
+        {"Alpha", 0x3000, {}},
+        {"Beta", 0x3100, {}},
+        {"Zero", 0, {}},             // RVA 0 - ни на что не указывает
+        {"Forward", 0, "OTHER.Func"},
+        {{}, 0, {}},                 // пустая ячейка
+        {"Last", 0x3400, {}},
+    };
+    
+    Test::SyntheticImage image(exports, 10);
+    ExportDirectory directory;
+    XMEMMOD_CHECK(image.ReadDirectory(directory));
+    
+    ExportTable table;
+    if (!XMEMMOD_CHECK(table.Build(directory))) {
+        return;
+    }
+    
+    const AddressIndex& index = table.addresses;
+    XMEMMOD_CHECK(index.Size() == 3);
+    
+    ExportSymbol symbol{};
+    XMEMMOD_CHECK(!index.Find(0, table.view, symbol));
+    XMEMMOD_CHECK(!index.Find(Test::SyntheticImage::kDirectoryRva, table.view, symbol));  // строка форвардера
+    XMEMMOD_CHECK(!index.Find(0x2FFF, table.view, symbol));
+    
+    if (XMEMMOD_CHECK(index.Find(0x3000, table.view, symbol))) {
+        XMEMMOD_CHECK(symbol.name == "Alpha");
+        XMEMMOD_CHECK(symbol.ordinal == 11);
+        XMEMMOD_CHECK(symbol.rva == 0x3000 && symbol.offset == 0 && symbol.size == 0x100);
+        XMEMMOD_CHECK(symbol.address == image.Data() + 0x3000);
+    }
+    
+    if (XMEMMOD_CHECK(index.Find(0x30FF, table.view, symbol))) {
+        XMEMMOD_CHECK(symbol.name == "Alpha" && symbol.offset == 0xFF);
+    }
+    
+    if (XMEMMOD_CHECK(index.Find(0x3100, table.view, symbol))) {
+        XMEMMOD_CHECK(symbol.name == "Beta" && symbol.offset == 0 && symbol.size == 0x300);
+        XMEMMOD_CHECK(table.view[symbol.position].name == "Beta");
+    }
+    
+    // Последний экспорт тянется до конца образа
+    if (XMEMMOD_CHECK(index.Find(0x3410, table.view, symbol))) {
+        XMEMMOD_CHECK(symbol.name == "Last" && symbol.offset == 0x10);
+        XMEMMOD_CHECK(symbol.size == image.Size() - 0x3400);
+    }
+}
+
+// Параллельное построение (1/4/8 потоков) даёт тот же индекс, что и
+// последовательное: те же слоты, тот же победитель среди дубликатов имён
+void TestParallelBuildMatchesSequential() {
+    const UInt32 count = ExportIndex::kParallelThreshold * 3 + 17;
+    std::vector<Test::SyntheticExport> exports = Test::NumberedExports(count);
+    
+    // Дубликаты имён и псевдонимы: несколько имён на одну функцию
+    std::vector<Test::SyntheticAlias> aliases;
+    for (UInt32 i = 0; i < 500; ++i) {
+        aliases.push_back(Test::SyntheticAlias{"Function_" + std::to_string(i * 7), static_cast<UInt16>(i * 3 + 1)});
+        aliases.push_back(Test::SyntheticAlias{"Alias_" + std::to_string(i), static_cast<UInt16>(i * 11)});
+    }
+    
+    Test::SyntheticImage image(exports, 1, aliases);
+    ExportDirectory directory;
+    XMEMMOD_CHECK(image.ReadDirectory(directory));
+    
+    ExportIndex sequential;
+    XMEMMOD_CHECK(sequential.Build(directory, 1));
+    XMEMMOD_CHECK(sequential.Size() == count + aliases.size());
+    
+    for (UInt32 workers : {4u, 8u, 0u}) {
+        ExportIndex parallel;
+        XMEMMOD_CHECK(parallel.Build(directory, workers));
+        if (!XMEMMOD_CHECK(parallel.Size() == sequential.Size())) {
+            continue;
+        }
+        
+        for (UInt32 slot = 0; slot < sequential.Size(); ++slot) {
+            XMEMMOD_CHECK(parallel.FunctionIndexAt(slot) == sequential.FunctionIndexAt(slot));
+            
+            const char* name = sequential.NameAt(slot);
+            XMEMMOD_CHECK(parallel.Find(name) == sequential.Find(name));
+        }
+        
+        XMEMMOD_CHECK(parallel.Find("Function_") == ExportIndex::kNotFound);
+        XMEMMOD_CHECK(parallel.Find("Alias_500") == ExportIndex::kNotFound);
+    }
+}
+
+// Перечисление по префиксу и шаблону: порядок по имени, ранняя остановка,
+// совпадение с полным перебором
+void TestNamePatterns() {
+    XMEMMOD_CHECK(MatchSymbolPattern("a*b*c", "aXbYc"));
+    XMEMMOD_CHECK(MatchSymbolPattern("a?c", "abc"));
+    XMEMMOD_CHECK(MatchSymbolPattern("**x", "x"));
+    XMEMMOD_CHECK(MatchSymbolPattern("*", ""));
+    XMEMMOD_CHECK(!MatchSymbolPattern("?", ""));
+    XMEMMOD_CHECK(!MatchSymbolPattern("a*", "b"));
+    XMEMMOD_CHECK(!MatchSymbolPattern("a*c", "abcd"));
+    
+    std::vector<Test::SyntheticExport> exports = Test::NumberedExports(300);
+    for (const char* name : {"Plugin_", "Plugin_Init", "Plugin_Run", "Plugin_Stop", "PluginX", "Other_Run", "A", "Zeta"}) {
+        exports.push_back(Test::SyntheticExport{name, 0x20000 + 16 * static_cast<UInt32>(exports.size()), {}});
+    }
+    exports.push_back(Test::SyntheticExport{{}, 0x30000, {}});  // без имени - в перечисление не попадает
+    
+    Test::SyntheticImage image(exports);
+    ExportDirectory directory;
+    XMEMMOD_CHECK(image.ReadDirectory(directory));
+    
+    ExportTable table;
+    if (!XMEMMOD_CHECK(table.Build(directory))) {
+        return;
+    }
+    
+    auto collect = [&](std::string_view pattern) {
+        std::vector<std::string> names;
+        size_t matches = table.names.ForEachMatch(pattern, table.view, [&](const ExportView::Entry& entry) {
+            names.emplace_back(entry.name);
+        });
+        XMEMMOD_CHECK(matches == names.size());
+        return names;
+    };
+    
+    std::vector<std::string> plugin = {"Plugin_", "Plugin_Init", "Plugin_Run", "Plugin_Stop"};
+    XMEMMOD_CHECK(collect("Plugin_") == plugin);
+    XMEMMOD_CHECK(collect("Plugin_*") == plugin);
+    XMEMMOD_CHECK(collect("Plugin_?nit") == std::vector<std::string>{"Plugin_Init"});
+    XMEMMOD_CHECK(collect("*_Run") == (std::vector<std::string>{"Other_Run", "Plugin_Run"}));
+    XMEMMOD_CHECK(collect("Zz").empty());
+    XMEMMOD_CHECK(collect("").size() == exports.size() - 1);
+    
+    UInt32 first = 0;
+    UInt32 last = 0;
+    table.names.PrefixRange("Plugin", table.view, first, last);
+    XMEMMOD_CHECK(last - first == 5);
+    table.names.PrefixRange("\xFF", table.view, first, last);
+    XMEMMOD_CHECK(first == last);
+    
+    // Callback, вернувший false, останавливает обход после первого совпадения
+    size_t visited = 0;
+    size_t matches = table.names.ForEachMatch("Function_*", table.view, [&](const ExportView::Entry&) {
+        ++visited;
+        return false;
+    });
+    XMEMMOD_CHECK(visited == 1 && matches == 1);
+    
+    // Сверка с полным перебором
+    for (const char* pattern : {"Function_1*", "*9", "Function_?5", "*_1?3", "F*n_2*", "*"}) {
+        size_t expected = 0;
+        for (const auto& entry : exports) {
+            expected += !entry.name.empty() && MatchSymbolPattern(pattern, entry.name);
+        }
+        
+        std::vector<std::string> names = collect(pattern);
+        XMEMMOD_CHECK(names.size() == expected);
+        XMEMMOD_CHECK(std::is_sorted(names.begin(), names.end()));
+    }
+}
+
+} // namespace
+
+int main() {
+    TestHashFastMatchesHash();
+    TestIndexLookup();
+    TestNameTableSearch();
+    TestAddressLookup();
+    TestParallelBuildMatchesSequential();
+    TestNamePatterns();
+    return Test::Finish("xMemModExportsTest");
+}
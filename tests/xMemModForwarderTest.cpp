@@ -0,0 +1,168 @@
+﻿/**
+ * @file xMemModForwarderTest.cpp
+ * @brief MemoryModule - Тесты разбора и кэша форвардеров
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModTest.h"
+
+#include <stdexcept>
+
+using namespace MemoryModule;
+
+namespace {
+
+// Поддельные "адреса" функций внутри одного массива (для Invalidate по диапазону)
+UInt8 g_image[64];
+
+// Разбор "MODULE.Func" и "MODULE.#N" и отказ на некорректных строках
+void TestParseForwarder() {
+    ForwarderTarget target;
+    
+    XMEMMOD_CHECK(ParseForwarder("KERNEL32.Sleep", target));
+    XMEMMOD_CHECK(target.module == "KERNEL32" && target.symbol == "Sleep" && !target.by_ordinal);
+    
+    XMEMMOD_CHECK(ParseForwarder("NTDLL.#12", target));
+    XMEMMOD_CHECK(target.module == "NTDLL" && target.symbol.empty() && target.by_ordinal && target.ordinal == 12);
+    
+    XMEMMOD_CHECK(ParseForwarder("LIB.#65535", target) && target.ordinal == 65535);
+    
+    for (const char* text : {"", ".Func", "MODULE", "MODULE.", "MODULE.#", "MODULE.#12a", "MODULE.#65536", "MODULE.#1234567"}) {
+        XMEMMOD_CHECK(!ParseForwarder(text, target));
+    }
+}
+
+// Кэш: попадание в своей области, изоляция областей, сброс области и диапазона
+void TestCacheScopes() {
+    ForwarderCache& cache = ForwarderCache::Instance();
+    ForwarderScope first = ForwarderCache::NewScope();
+    ForwarderScope second = ForwarderCache::NewScope();
+    XMEMMOD_CHECK(first != kDefaultForwarderScope && second != kDefaultForwarderScope && first != second);
+    
+    int first_calls = 0;
+    ForwarderResolver first_resolver = [&](const ForwarderTarget& target) -> const void* {
+        ++first_calls;
+        return target.symbol == "Func" ? &g_image[1] : nullptr;
+    };
+    
+    int second_calls = 0;
+    ForwarderResolver second_resolver = [&](const ForwarderTarget&) -> const void* {
+        ++second_calls;
+        return &g_image[2];
+    };
+    
+    // Повторное разрешение и другой регистр имени модуля - из кэша
+    XMEMMOD_CHECK(ResolveForwarder("LIB.Func", first_resolver, first) == &g_image[1]);
+    XMEMMOD_CHECK(ResolveForwarder("LIB.Func", first_resolver, first) == &g_image[1]);
+    XMEMMOD_CHECK(ResolveForwarder("lib.Func", first_resolver, first) == &g_image[1]);
+    XMEMMOD_CHECK(first_calls == 1);
+    
+    // Имя символа сравнивается с учётом регистра
+    XMEMMOD_CHECK(ResolveForwarder("LIB.func", first_resolver, first) == nullptr);
+    XMEMMOD_CHECK(first_calls == 2);
+    
+    // Промах не кэшируется
+    XMEMMOD_CHECK(ResolveForwarder("LIB.func", first_resolver, first) == nullptr);
+    XMEMMOD_CHECK(first_calls == 3);
+    
+    // Другая область не видит чужой результат
+    XMEMMOD_CHECK(ResolveForwarder("LIB.Func", second_resolver, second) == &g_image[2]);
+    XMEMMOD_CHECK(second_calls == 1);
+    XMEMMOD_CHECK(ResolveForwarder("LIB.Func", first_resolver, first) == &g_image[1]);
+    XMEMMOD_CHECK(first_calls == 3);
+    
+    // Сброс области затрагивает только её
+    cache.InvalidateScope(first);
+    XMEMMOD_CHECK(ResolveForwarder("LIB.Func", first_resolver, first) == &g_image[1]);
+    XMEMMOD_CHECK(first_calls == 4);
+    XMEMMOD_CHECK(ResolveForwarder("LIB.Func", second_resolver, second) == &g_image[2]);
+    XMEMMOD_CHECK(second_calls == 1);
+    
+    // Выгрузка образа удаляет адреса внутри него во всех областях
+    ForwarderTarget target;
+    XMEMMOD_CHECK(ParseForwarder("LIB.Func", target));
+    const void* address = nullptr;
+    cache.Invalidate(&g_image[2], 1);
+    XMEMMOD_CHECK(!cache.Find(second, target, address));
+    XMEMMOD_CHECK(cache.Find(first, target, address) && address == &g_image[1]);
+    
+    // Без резолвера - только кэш
+    XMEMMOD_CHECK(ResolveForwarder("LIB.Func", ForwarderResolver(), first) == &g_image[1]);
+    XMEMMOD_CHECK(ResolveForwarder("LIB.Other", ForwarderResolver(), first) == nullptr);
+    
+    // Форвардер по ординалу - отдельный ключ
+    cache.Insert(first, ForwarderTarget{"LIB", {}, 7, true}, &g_image[7]);
+    XMEMMOD_CHECK(ResolveForwarder("LIB.#7", ForwarderResolver(), first) == &g_image[7]);
+    XMEMMOD_CHECK(ResolveForwarder("LIB.#8", ForwarderResolver(), first) == nullptr);
+    
+    cache.InvalidateScope(first);
+    cache.InvalidateScope(second);
+}
+
+// Цикл форвардеров обрывается ограничением глубины, исключение резолвера -
+// промах, и ни то ни другое не попадает в кэш
+void TestResolverFailures() {
+    ForwarderScope scope = ForwarderCache::NewScope();
+    
+    int calls = 0;
+    ForwarderResolver cyclic;
+    cyclic = [&](const ForwarderTarget& target) -> const void* {
+        ++calls;
+        return ResolveForwarder(target.module == "A" ? "B.Func" : "A.Func", cyclic, scope);
+    };
+    XMEMMOD_CHECK(ResolveForwarder("A.Func", cyclic, scope) == nullptr);
+    XMEMMOD_CHECK(calls > 1 && calls <= 64);
+    
+    ForwarderResolver throwing = [](const ForwarderTarget&) -> const void* {
+        throw std::runtime_error("resolver");
+    };
+    XMEMMOD_CHECK(ResolveForwarder("A.Func", throwing, scope) == nullptr);
+    
+    // После обрыва цикла обычное разрешение работает
+    ForwarderResolver plain = [](const ForwarderTarget&) -> const void* { return &g_image[3]; };
+    XMEMMOD_CHECK(ResolveForwarder("A.Func", plain, scope) == &g_image[3]);
+    
+    ForwarderCache::Instance().InvalidateScope(scope);
+}
+
+// Форвардеры в таблице экспортов распознаются по RVA внутри каталога
+void TestForwarderDetection() {
+    std::vector<Test::SyntheticExport> exports = Test::NumberedExports(4);
+    exports[1].forwarder = "KERNEL32.Sleep";
+    exports[3].forwarder = "NTDLL.#12";
+    
+    Test::SyntheticImage image(exports);
+    ExportDirectory directory;
+    XMEMMOD_CHECK(image.ReadDirectory(directory));
+    
+    ExportTable table;
+    if (!XMEMMOD_CHECK(table.Build(directory))) {
+        return;
+    }
+    
+    for (UInt32 i = 0; i < exports.size(); ++i) {
+        UInt32 slot = table.index.Find(exports[i].name.c_str());
+        if (!XMEMMOD_CHECK(slot != ExportIndex::kNotFound)) {
+            continue;
+        }
+        
+        UInt32 rva = table.RvaAt(slot);
+        XMEMMOD_CHECK(table.IsForwarder(rva) == !exports[i].forwarder.empty());
+        XMEMMOD_CHECK(directory.ForwarderAt(rva) == exports[i].forwarder);
+    }
+}
+
+} // namespace
+
+int main() {
+    TestParseForwarder();
+    TestCacheScopes();
+    TestResolverFailures();
+    TestForwarderDetection();
+    return Test::Finish("xMemModForwarderTest");
+}
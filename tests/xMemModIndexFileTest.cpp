@@ -0,0 +1,142 @@
+﻿/**
+ * @file xMemModIndexFileTest.cpp
+ * @brief MemoryModule - Тесты сохраняемого индекса экспортов
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModTest.h"
+#include "xMemModIndexFile.h"
+
+using namespace MemoryModule;
+
+namespace {
+
+constexpr ImageFingerprint kFingerprint = {0x40000, 0x5F000000u, 0x1234};
+
+// Файл, подключённый к тому же образу, отвечает так же, как ExportIndex
+void TestRoundTrip() {
+    std::vector<Test::SyntheticExport> exports = Test::NumberedExports(2000);
+    exports[7].name.clear();
+    
+    Test::SyntheticImage image(exports, 3);
+    ExportDirectory directory;
+    XMEMMOD_CHECK(image.ReadDirectory(directory));
+    
+    std::vector<UInt8> file;
+    XMEMMOD_CHECK(BuildExportIndexFile(directory, kFingerprint, file));
+    
+    // Генерация детерминирована
+    std::vector<UInt8> again;
+    XMEMMOD_CHECK(BuildExportIndexFile(directory, kFingerprint, again));
+    XMEMMOD_CHECK(file == again);
+    
+    MappedExportIndex mapped;
+    if (!XMEMMOD_CHECK(mapped.Attach(file.data(), file.size(), directory, kFingerprint))) {
+        return;
+    }
+    XMEMMOD_CHECK(mapped.Size() == exports.size() - 1);
+    
+    ExportIndex index;
+    XMEMMOD_CHECK(index.Build(directory));
+    
+    for (UInt32 i = 0; i < exports.size(); ++i) {
+        size_t length = 0;
+        const char* name = mapped.NameOfFunction(i, &length);
+        
+        if (exports[i].name.empty()) {
+            XMEMMOD_CHECK(name == nullptr);
+            continue;
+        }
+        
+        XMEMMOD_CHECK(name && std::string(name, length) == exports[i].name);
+        XMEMMOD_CHECK(mapped.Find(exports[i].name.c_str()) == i);
+        XMEMMOD_CHECK(mapped.Find(SymbolKey(exports[i].name.c_str())) == index.FunctionIndexAt(index.Find(exports[i].name.c_str())));
+    }
+    
+    XMEMMOD_CHECK(mapped.Find("Function_7") == MappedExportIndex::kNotFound);
+    XMEMMOD_CHECK(mapped.Find("Missing") == MappedExportIndex::kNotFound);
+    XMEMMOD_CHECK(mapped.NameOfFunction(static_cast<UInt32>(exports.size())) == nullptr);
+}
+
+// Файл чужого или изменённого образа и повреждённый файл не подключаются
+void TestRejectsStaleAndCorrupt() {
+    std::vector<Test::SyntheticExport> exports = Test::NumberedExports(100);
+    Test::SyntheticImage image(exports);
+    ExportDirectory directory;
+    XMEMMOD_CHECK(image.ReadDirectory(directory));
+    
+    std::vector<UInt8> file;
+    XMEMMOD_CHECK(BuildExportIndexFile(directory, kFingerprint, file));
+    
+    MappedExportIndex mapped;
+    auto attach = [&](const std::vector<UInt8>& data, const ExportDirectory& target, const ImageFingerprint& fingerprint) {
+        bool attached = mapped.Attach(data.data(), data.size(), target, fingerprint);
+        XMEMMOD_CHECK(attached == mapped.IsAttached());
+        return attached;
+    };
+    
+    XMEMMOD_CHECK(attach(file, directory, kFingerprint));
+    
+    // Другие поля заголовков PE
+    ImageFingerprint stamp = kFingerprint;
+    stamp.time_date_stamp += 1;
+    XMEMMOD_CHECK(!attach(file, directory, stamp));
+    
+    ImageFingerprint checksum = kFingerprint;
+    checksum.checksum ^= 1;
+    XMEMMOD_CHECK(!attach(file, directory, checksum));
+    
+    // Тот же размер и раскладка каталога, но другой RVA функции - ключ устарел
+    exports[42].rva += 16;
+    Test::SyntheticImage changed(exports);
+    ExportDirectory changed_directory;
+    XMEMMOD_CHECK(changed.ReadDirectory(changed_directory));
+    XMEMMOD_CHECK(changed_directory.directory_size == directory.directory_size);
+    XMEMMOD_CHECK(ExportIndexKey(changed_directory, kFingerprint) != ExportIndexKey(directory, kFingerprint));
+    XMEMMOD_CHECK(!attach(file, changed_directory, kFingerprint));
+    
+    // Повреждения самого файла
+    auto header_of = [](std::vector<UInt8>& data) { return reinterpret_cast<IndexFile::Header*>(data.data()); };
+    
+    std::vector<UInt8> version = file;
+    header_of(version)->version = IndexFile::kVersion + 1;
+    XMEMMOD_CHECK(!attach(version, directory, kFingerprint));
+    
+    std::vector<UInt8> magic = file;
+    header_of(magic)->magic ^= 1;
+    XMEMMOD_CHECK(!attach(magic, directory, kFingerprint));
+    
+    std::vector<UInt8> truncated(file.begin(), file.end() - 1);
+    XMEMMOD_CHECK(!attach(truncated, directory, kFingerprint));
+    
+    std::vector<UInt8> header_only(file.begin(), file.begin() + sizeof(IndexFile::Header) - 1);
+    XMEMMOD_CHECK(!attach(header_only, directory, kFingerprint));
+    
+    std::vector<UInt8> entry = file;
+    auto* entries = reinterpret_cast<IndexFile::Entry*>(entry.data() + header_of(entry)->entries_offset);
+    entries[0].name_rva = 0xFFFFFF00u;
+    XMEMMOD_CHECK(!attach(entry, directory, kFingerprint));
+    
+    std::vector<UInt8> slot = file;
+    auto* slots = reinterpret_cast<IndexFile::Slot*>(slot.data() + header_of(slot)->slots_offset);
+    slots[0].entry = header_of(slot)->entry_count + 1;
+    XMEMMOD_CHECK(!attach(slot, directory, kFingerprint));
+    
+    XMEMMOD_CHECK(!mapped.Attach(nullptr, file.size(), directory, kFingerprint));
+    
+    // Исходный файл по-прежнему подключается
+    XMEMMOD_CHECK(attach(file, directory, kFingerprint));
+}
+
+} // namespace
+
+int main() {
+    TestRoundTrip();
+    TestRejectsStaleAndCorrupt();
+    return Test::Finish("xMemModIndexFileTest");
+}
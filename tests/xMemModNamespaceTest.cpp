@@ -0,0 +1,153 @@
+﻿/**
+ * @file xMemModNamespaceTest.cpp
+ * @brief MemoryModule - Тесты общего пространства имён нескольких модулей
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModTest.h"
+
+#include <memory>
+
+using namespace MemoryModule;
+
+namespace {
+
+// Синтетический модуль: образ и построенная по нему таблица экспортов
+struct SyntheticModule {
+    explicit SyntheticModule(const std::vector<std::string>& names) : image(Exports(names)) {
+        ExportDirectory directory;
+        XMEMMOD_CHECK(image.ReadDirectory(directory));
+        XMEMMOD_CHECK(table.Build(directory));
+    }
+
+    static std::vector<Test::SyntheticExport> Exports(const std::vector<std::string>& names) {
+        std::vector<Test::SyntheticExport> exports;
+        for (const auto& name : names) {
+            exports.push_back(Test::SyntheticExport{name, 0x10000 + 16 * static_cast<UInt32>(exports.size()), {}});
+        }
+        return exports;
+    }
+
+    Test::SyntheticImage image;
+    ExportTable table;
+};
+
+// Владельцы поставщиков имени в порядке правила
+std::vector<const void*> Owners(const SymbolNamespace& symbols, std::string_view name) {
+    SymbolKey key(name.data(), 0);
+    key.length = static_cast<UInt32>(name.size());
+    key.hash = SymbolHash::HashFast(name.data(), name.size());
+
+    size_t count = 0;
+    const SymbolNamespace::Provider* providers = symbols.FindAll(key, count);
+    std::vector<const void*> owners;
+    for (size_t i = 0; i < count; ++i) {
+        owners.push_back(providers[i].owner);
+    }
+    return owners;
+}
+
+// Одно имя у двух модулей: оба поставщика, позиция указывает на имя в своём виде
+void TestDuplicateProviders() {
+    SyntheticModule first({"Shared", "OnlyFirst"});
+    SyntheticModule second({"OnlySecond", "Shared", "Tail"});
+
+    SymbolNamespace symbols;
+    XMEMMOD_CHECK(symbols.Add(&first, 0, first.table.view));
+    XMEMMOD_CHECK(symbols.Add(&second, 0, second.table.view));
+    XMEMMOD_CHECK(symbols.Size() == 4);
+
+    XMEMMOD_CHECK(Owners(symbols, "Shared") == (std::vector<const void*>{&first, &second}));
+    XMEMMOD_CHECK(Owners(symbols, "OnlySecond") == std::vector<const void*>{&second});
+    XMEMMOD_CHECK(Owners(symbols, "Missing").empty());
+    XMEMMOD_CHECK(symbols.Find("Missing") == nullptr);
+
+    const SymbolNamespace::Provider* provider = symbols.Find("Tail");
+    if (XMEMMOD_CHECK(provider != nullptr)) {
+        XMEMMOD_CHECK(provider->owner == &second);
+        XMEMMOD_CHECK(second.table.view.NameAt(provider->position) == "Tail");
+    }
+
+    symbols.Remove(&second, second.table.view);
+    XMEMMOD_CHECK(symbols.Size() == 2);
+    XMEMMOD_CHECK(Owners(symbols, "Shared") == std::vector<const void*>{&first});
+    XMEMMOD_CHECK(symbols.Find("Tail") == nullptr);
+
+    symbols.Remove(&first, first.table.view);
+    XMEMMOD_CHECK(symbols.Size() == 0);
+}
+
+// Ключ указывает в образ первого добавившего имя модуля; после удаления этого
+// модуля ключ переносится на имя оставшегося, и затёртый образ не мешает поиску
+void TestRemoveKeyOwner() {
+    auto owner = std::make_unique<SyntheticModule>(std::vector<std::string>{"Shared", "Own"});
+    SyntheticModule other({"Shared", "Other"});
+
+    SymbolNamespace symbols;
+    XMEMMOD_CHECK(symbols.Add(owner.get(), 0, owner->table.view));
+    XMEMMOD_CHECK(symbols.Add(&other, 0, other.table.view));
+
+    symbols.Remove(owner.get(), owner->table.view);
+    memset(owner->image.Data(), 0, owner->image.Size());
+    owner.reset();
+
+    const SymbolNamespace::Provider* provider = symbols.Find("Shared");
+    if (XMEMMOD_CHECK(provider != nullptr)) {
+        XMEMMOD_CHECK(provider->owner == &other);
+        XMEMMOD_CHECK(provider->name == "Shared");
+    }
+    XMEMMOD_CHECK(symbols.Find("Own") == nullptr);
+    XMEMMOD_CHECK(symbols.Size() == 2);
+}
+
+// Три правила выбора и пересортировка при смене правила
+void TestPrecedence() {
+    SyntheticModule low({"Init"});
+    SyntheticModule high({"Init"});
+    SyntheticModule middle({"Init"});
+    SyntheticModule tie({"Init"});
+
+    SymbolNamespace symbols;
+    XMEMMOD_CHECK(symbols.Add(&low, 1, low.table.view));
+    XMEMMOD_CHECK(symbols.Add(&high, 9, high.table.view));
+    XMEMMOD_CHECK(symbols.Add(&middle, 5, middle.table.view));
+    XMEMMOD_CHECK(symbols.Add(&tie, 5, tie.table.view));
+
+    XMEMMOD_CHECK(symbols.Precedence() == SymbolPrecedence::FirstAdded);
+    XMEMMOD_CHECK(Owners(symbols, "Init") == (std::vector<const void*>{&low, &high, &middle, &tie}));
+
+    symbols.SetPrecedence(SymbolPrecedence::LastAdded);
+    XMEMMOD_CHECK(Owners(symbols, "Init") == (std::vector<const void*>{&tie, &middle, &high, &low}));
+
+    // При равном приоритете побеждает добавленный раньше
+    symbols.SetPrecedence(SymbolPrecedence::Priority);
+    XMEMMOD_CHECK(Owners(symbols, "Init") == (std::vector<const void*>{&high, &middle, &tie, &low}));
+
+    // Добавление после смены правила встаёт на своё место
+    SyntheticModule top({"Init"});
+    XMEMMOD_CHECK(symbols.Add(&top, 7, top.table.view));
+    XMEMMOD_CHECK(Owners(symbols, "Init") == (std::vector<const void*>{&high, &top, &middle, &tie, &low}));
+
+    symbols.SetPrecedence(SymbolPrecedence::FirstAdded);
+    XMEMMOD_CHECK(symbols.Find("Init")->owner == &low);
+
+    // Правило, заданное при создании
+    SymbolNamespace overriding(SymbolPrecedence::LastAdded);
+    XMEMMOD_CHECK(overriding.Add(&low, 0, low.table.view));
+    XMEMMOD_CHECK(overriding.Add(&high, 0, high.table.view));
+    XMEMMOD_CHECK(overriding.Find("Init")->owner == &high);
+}
+
+} // namespace
+
+int main() {
+    TestDuplicateProviders();
+    TestRemoveKeyOwner();
+    TestPrecedence();
+    return Test::Finish("xMemModNamespaceTest");
+}
@@ -0,0 +1,280 @@
+﻿/**
+ * @file xMemModRelocTest.cpp
+ * @brief MemoryModule - Тесты применения базовых релокаций
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModTest.h"
+#include "xMemModReloc.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace MemoryModule;
+
+namespace {
+
+constexpr UInt32 kPageSize = 0x1000;
+constexpr UInt64 kDelta = 0x0000123456789ABCull;
+
+// Блок таблицы: страница и 16-битные записи (тип << 12 | смещение)
+struct Block {
+    UInt32 page_rva;
+    std::vector<UInt16> entries;
+};
+
+UInt16 Entry(UInt16 type, UInt32 offset) {
+    return static_cast<UInt16>(type << 12 | offset);
+}
+
+// Таблица в формате IMAGE_BASE_RELOCATION с завершающим нулевым блоком
+std::vector<UInt8> BuildTable(const std::vector<Block>& blocks) {
+    std::vector<UInt8> table;
+    auto put = [&table](const void* data, size_t size) {
+        const auto* bytes = static_cast<const UInt8*>(data);
+        table.insert(table.end(), bytes, bytes + size);
+    };
+    
+    for (const Block& block : blocks) {
+        UInt32 size = static_cast<UInt32>(8 + 2 * block.entries.size());
+        put(&block.page_rva, 4);
+        put(&size, 4);
+        put(block.entries.data(), 2 * block.entries.size());
+    }
+    
+    table.resize(table.size() + 8, 0);
+    return table;
+}
+
+// Эталон: запись за записью, без разбора блоков библиотекой
+void ApplyReference(std::vector<UInt8>& image, const std::vector<Block>& blocks, UInt64 delta) {
+    for (const Block& block : blocks) {
+        for (UInt16 entry : block.entries) {
+            UInt8* address = image.data() + block.page_rva + (entry & 0xFFF);
+            UInt64 value = 0;
+            switch (entry >> 12) {
+                case RelocationType::kDir64:
+                    memcpy(&value, address, 8);
+                    value += delta;
+                    memcpy(address, &value, 8);
+                    break;
+                case RelocationType::kHighLow:
+                    memcpy(&value, address, 4);
+                    value += delta;
+                    memcpy(address, &value, 4);
+                    break;
+                case RelocationType::kHigh:
+                    memcpy(&value, address, 2);
+                    value += delta >> 16;
+                    memcpy(address, &value, 2);
+                    break;
+                case RelocationType::kLow:
+                    memcpy(&value, address, 2);
+                    value += delta;
+                    memcpy(address, &value, 2);
+                    break;
+            }
+        }
+    }
+}
+
+// Образ из pages страниц со случайным содержимым
+std::vector<UInt8> RandomImage(UInt32 pages, UInt32 seed) {
+    std::mt19937 random(seed);
+    std::vector<UInt8> image(static_cast<size_t>(pages) * kPageSize);
+    for (auto& byte : image) {
+        byte = static_cast<UInt8>(random());
+    }
+    return image;
+}
+
+// Разбор границ блоков и отказ на повреждённых заголовках
+void TestIndexBlocks() {
+    std::vector<Block> blocks = {
+        {0x1000, {Entry(RelocationType::kDir64, 0x10), Entry(RelocationType::kAbsolute, 0)}},
+        {0x3000, {}},
+        {0x2000, {Entry(RelocationType::kHighLow, 0x20)}},
+    };
+    std::vector<UInt8> table = BuildTable(blocks);
+    
+    std::vector<RelocationBlock> index;
+    XMEMMOD_CHECK(IndexRelocationBlocks(table.data(), table.size(), index));
+    if (XMEMMOD_CHECK(index.size() == 3)) {
+        XMEMMOD_CHECK(index[0].page_rva == 0x1000 && index[0].entries_offset == 8 && index[0].count == 2);
+        XMEMMOD_CHECK(index[1].page_rva == 0x3000 && index[1].entries_offset == 20 && index[1].count == 0);
+        XMEMMOD_CHECK(index[2].page_rva == 0x2000 && index[2].entries_offset == 28 && index[2].count == 1);
+    }
+    
+    // Без завершающего блока таблица тоже читается до конца
+    XMEMMOD_CHECK(IndexRelocationBlocks(table.data(), table.size() - 8, index) && index.size() == 3);
+    
+    auto corrupt = [&](size_t offset, UInt32 block_size) {
+        std::vector<UInt8> copy = table;
+        memcpy(&copy[offset + 4], &block_size, 4);
+        return !IndexRelocationBlocks(copy.data(), copy.size(), index);
+    };
+    XMEMMOD_CHECK(corrupt(0, 4));                                         // меньше заголовка
+    XMEMMOD_CHECK(corrupt(0, 13));                                        // нечётный
+    XMEMMOD_CHECK(corrupt(20, static_cast<UInt32>(table.size())));        // за таблицу
+}
+
+// Записи за пределами образа и неизвестные типы отклоняются
+void TestRejectsBadEntries() {
+    std::vector<UInt8> image = RandomImage(4, 1);
+    std::vector<UInt8> original = image;
+    RelocationOptions options;
+    options.max_workers = 1;
+    
+    auto apply = [&](const std::vector<Block>& blocks) {
+        std::vector<UInt8> table = BuildTable(blocks);
+        std::vector<RelocationBlock> index;
+        return IndexRelocationBlocks(table.data(), table.size(), index) &&
+               ApplyRelocationBlocks(image.data(), image.size(), table.data(), index.data(), index.size(), kDelta);
+    };
+    
+    XMEMMOD_CHECK(!apply({{0x3000, {Entry(RelocationType::kDir64, 0xFFC)}}}));   // 8 байт через конец образа
+    XMEMMOD_CHECK(!apply({{0x5000, {Entry(RelocationType::kHighLow, 0)}}}));     // страница вне образа
+    XMEMMOD_CHECK(!apply({{0x1000, {Entry(5, 0x10)}}}));                         // неподдерживаемый тип
+    XMEMMOD_CHECK(apply({{0x3000, {Entry(RelocationType::kDir64, 0xFF8)}}}));    // ровно до конца
+    
+    // Таблица вне образа; нулевая разница баз ничего не трогает
+    image = original;
+    XMEMMOD_CHECK(!ApplyRelocations(image.data(), image.size(), 0x3F00, 0x200, kDelta, options));
+    XMEMMOD_CHECK(ApplyRelocations(image.data(), image.size(), 0x100, 0x10, 0, options));
+    XMEMMOD_CHECK(image == original);
+}
+
+// Таблица, записанная в сам образ, применяется одинаково в одном потоке и в нескольких
+void TestParallelMatchesSequential() {
+    const UInt32 pages = 700;
+    std::mt19937 random(7);
+    
+    std::vector<Block> blocks;
+    for (UInt32 page = 1; page < pages; ++page) {
+        Block block{page * kPageSize, {}};
+        UInt32 count = random() % 40;
+        for (UInt32 i = 0; i < count; ++i) {
+            UInt16 type = i % 5 == 4 ? RelocationType::kHighLow : RelocationType::kDir64;
+            block.entries.push_back(Entry(type, i * 0x60 + (random() % 8) * 8));
+        }
+        if (block.entries.size() % 2 != 0) {
+            block.entries.push_back(Entry(RelocationType::kAbsolute, 0));
+        }
+        blocks.push_back(std::move(block));
+    }
+    std::vector<UInt8> table = BuildTable(blocks);
+    
+    // Таблица дописана в конец образа, куда сами релокации не попадают
+    std::vector<UInt8> image = RandomImage(pages, 3);
+    image.resize(image.size() + table.size());
+    UInt32 table_rva = static_cast<UInt32>(image.size() - table.size());
+    memcpy(&image[table_rva], table.data(), table.size());
+    
+    std::vector<UInt8> expected = image;
+    ApplyReference(expected, blocks, kDelta);
+    
+    for (size_t workers : {size_t(1), size_t(4), size_t(8)}) {
+        std::vector<UInt8> relocated = image;
+        RelocationOptions options;
+        options.parallel_min_blocks = 16;
+        options.max_workers = workers;
+        XMEMMOD_CHECK(ApplyRelocations(relocated.data(), relocated.size(), table_rva,
+                                       static_cast<UInt32>(table.size()), kDelta, options));
+        XMEMMOD_CHECK(relocated == expected);
+    }
+    
+    // Ошибка в одном из потоков отменяет загрузку
+    blocks[pages / 2].entries[0] = Entry(7, 0);
+    table = BuildTable(blocks);
+    memcpy(&image[table_rva], table.data(), table.size());
+    RelocationOptions options;
+    options.parallel_min_blocks = 16;
+    options.max_workers = 4;
+    XMEMMOD_CHECK(!ApplyRelocations(image.data(), image.size(), table_rva, static_cast<UInt32>(table.size()),
+                                    kDelta, options));
+}
+
+// SIMD-ядро даёт те же байты, что и скалярный проход: плотные блоки разной
+// длины (граница группы 16), смешанные типы внутри группы, выравнивающие
+// записи, страница у конца образа (ядро не применяется)
+void TestVectorizedMatchesScalar() {
+    const UInt32 pages = 12;
+    
+    for (UInt32 seed = 1; seed <= 20; ++seed) {
+        std::mt19937 random(seed);
+        
+        // Непересекающиеся ячейки страницы в случайном порядке
+        auto slots = [&random](UInt32 width) {
+            std::vector<UInt32> offsets;
+            for (UInt32 offset = 0; offset + width <= kPageSize; offset += width) {
+                offsets.push_back(offset);
+            }
+            std::shuffle(offsets.begin(), offsets.end(), random);
+            return offsets;
+        };
+        
+        auto dense = [&](UInt32 page, UInt16 type, UInt32 count) {
+            std::vector<UInt32> offsets = slots(type == RelocationType::kDir64 ? 8 : 4);
+            Block block{page * kPageSize, {}};
+            for (UInt32 i = 0; i < count; ++i) {
+                block.entries.push_back(Entry(type, offsets[i]));
+            }
+            return block;
+        };
+        
+        std::vector<Block> blocks;
+        const UInt32 densities[] = {1, 15, 16, 17, 31, 32, 100, 512};
+        for (UInt32 i = 0; i < sizeof(densities) / sizeof(densities[0]); ++i) {
+            blocks.push_back(dense(i, RelocationType::kDir64, densities[i]));
+        }
+        blocks.push_back(dense(8, RelocationType::kHighLow, 16 + random() % 1000));
+        
+        // Смешанный блок: другой тип в случайном месте, выравнивание в конце
+        Block mixed = dense(9, RelocationType::kDir64, 100);
+        UInt32 odd = random() % 100;
+        mixed.entries[odd] = Entry(RelocationType::kHighLow, mixed.entries[odd] & 0xFFF);
+        mixed.entries.push_back(Entry(RelocationType::kAbsolute, 0));
+        blocks.push_back(mixed);
+        
+        // Первая запись 16-битная - плотная часть не начинается вовсе
+        Block low = dense(10, RelocationType::kDir64, 40);
+        low.entries[0] = Entry(random() % 2 ? RelocationType::kLow : RelocationType::kHigh, low.entries[0] & 0xFFF);
+        blocks.push_back(low);
+        
+        // Последняя страница: запаса kDensePageSpan нет
+        blocks.push_back(dense(pages - 1, RelocationType::kDir64, 64));
+        
+        std::shuffle(blocks.begin(), blocks.end(), random);
+        std::vector<UInt8> table = BuildTable(blocks);
+        std::vector<RelocationBlock> index;
+        XMEMMOD_CHECK(IndexRelocationBlocks(table.data(), table.size(), index));
+        
+        std::vector<UInt8> expected = RandomImage(pages, seed);
+        std::vector<UInt8> scalar = expected;
+        std::vector<UInt8> vectorized = expected;
+        UInt64 delta = (static_cast<UInt64>(random()) << 32 | random()) * (seed % 2 ? 1 : ~0ull);
+        ApplyReference(expected, blocks, delta);
+        
+        XMEMMOD_CHECK(ApplyRelocationBlocks(scalar.data(), scalar.size(), table.data(), index.data(), index.size(),
+                                            delta, false));
+        XMEMMOD_CHECK(ApplyRelocationBlocks(vectorized.data(), vectorized.size(), table.data(), index.data(),
+                                            index.size(), delta, true));
+        XMEMMOD_CHECK(scalar == expected);
+        XMEMMOD_CHECK(vectorized == expected);
+    }
+}
+
+} // namespace
+
+int main() {
+    TestIndexBlocks();
+    TestRejectsBadEntries();
+    TestParallelMatchesSequential();
+    TestVectorizedMatchesScalar();
+    return Test::Finish("xMemModRelocTest");
+}
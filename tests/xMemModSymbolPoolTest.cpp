@@ -0,0 +1,112 @@
+﻿/**
+ * @file xMemModSymbolPoolTest.cpp
+ * @brief MemoryModule - Тесты пула имён символов
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModTest.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+
+using namespace MemoryModule;
+
+namespace {
+
+// Потоки одновременно интернируют пересекающиеся наборы имён в разном
+// порядке: у каждого имени ровно один идентификатор, проигравшие гонку
+// узлы не попадают ни в корзины, ни в счётчик
+void TestConcurrentIntern() {
+    constexpr UInt32 kThreads = 8;
+    constexpr UInt32 kDistinct = 20000;
+    constexpr UInt32 kPerThread = kDistinct / 2;
+    
+    std::vector<std::string> names(kDistinct);
+    for (UInt32 i = 0; i < kDistinct; ++i) {
+        names[i] = "PoolTest_" + std::to_string(i);
+    }
+    
+    SymbolPool& pool = SymbolPool::Instance();
+    size_t base_size = pool.Size();
+    
+    // Поток t берёт половину имён со сдвигом: каждое имя - у нескольких потоков
+    std::vector<std::vector<SymbolId>> ids(kThreads, std::vector<SymbolId>(kDistinct, kInvalidSymbolId));
+    std::atomic<UInt32> ready{0};
+    std::vector<std::thread> threads;
+    
+    for (UInt32 t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            std::vector<UInt32> order(kPerThread);
+            for (UInt32 i = 0; i < kPerThread; ++i) {
+                order[i] = (t * (kDistinct / kThreads) + i) % kDistinct;
+            }
+            std::shuffle(order.begin(), order.end(), std::mt19937(t));
+            
+            // Общий старт, чтобы гонки за одни корзины действительно были
+            ready.fetch_add(1);
+            while (ready.load() != kThreads) {
+                std::this_thread::yield();
+            }
+            
+            for (UInt32 index : order) {
+                ids[t][index] = pool.Intern(names[index]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    std::vector<SymbolId> unique;
+    for (UInt32 i = 0; i < kDistinct; ++i) {
+        SymbolId id = pool.Find(names[i]);
+        if (!XMEMMOD_CHECK(id != kInvalidSymbolId)) {
+            continue;
+        }
+        
+        XMEMMOD_CHECK(pool.Name(id) == names[i]);
+        XMEMMOD_CHECK(pool.Intern(names[i]) == id);
+        for (UInt32 t = 0; t < kThreads; ++t) {
+            XMEMMOD_CHECK(ids[t][i] == kInvalidSymbolId || ids[t][i] == id);
+        }
+        unique.push_back(id);
+    }
+    
+    std::sort(unique.begin(), unique.end());
+    XMEMMOD_CHECK(std::adjacent_find(unique.begin(), unique.end()) == unique.end());
+    XMEMMOD_CHECK(pool.Size() - base_size == kDistinct);
+    
+    XMEMMOD_CHECK(pool.Find("PoolTest_") == kInvalidSymbolId);
+    XMEMMOD_CHECK(pool.Find("PoolTest_20000") == kInvalidSymbolId);
+    XMEMMOD_CHECK(pool.Find(std::string_view("")) == kInvalidSymbolId);
+    XMEMMOD_CHECK(pool.Size() - base_size == kDistinct);
+}
+
+// Ключ и имя по идентификатору; неизвестный идентификатор - пустое имя
+void TestKeyById() {
+    SymbolPool& pool = SymbolPool::Instance();
+    SymbolId id = pool.Intern("PoolTest_Key");
+    if (!XMEMMOD_CHECK(id != kInvalidSymbolId)) {
+        return;
+    }
+    
+    SymbolKey key = pool.Key(id);
+    XMEMMOD_CHECK(std::string_view(key.name, key.length) == "PoolTest_Key");
+    XMEMMOD_CHECK(key.hash == SymbolHash::HashFast("PoolTest_Key", 12));
+    XMEMMOD_CHECK(pool.Find(key) == id);
+    XMEMMOD_CHECK(pool.Name(kInvalidSymbolId).empty());
+}
+
+} // namespace
+
+int main() {
+    TestConcurrentIntern();
+    TestKeyById();
+    return Test::Finish("xMemModSymbolPoolTest");
+}
@@ -0,0 +1,221 @@
+/**
+ * @file xMemModTest.h
+ * @brief MemoryModule - Общие средства модульных тестов
+ * @details Проверки без внешних зависимостей и синтетический образ с
+ *          каталогом экспортов, собранный в памяти по правилам линкера
+ *          (таблица имён отсортирована, строки форвардеров внутри каталога).
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include "xMemModExports.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace MemoryModule {
+namespace Test {
+
+// Счётчик проваленных проверок
+inline int& Failures() noexcept {
+    static int failures = 0;
+    return failures;
+}
+
+inline bool Check(bool passed, const char* expression, const char* file, int line) noexcept {
+    if (!passed) {
+        ++Failures();
+        fprintf(stderr, "%s:%d: проверка не прошла: %s\n", file, line, expression);
+    }
+    return passed;
+}
+
+// Итог теста для main(): 0 - все проверки прошли
+inline int Finish(const char* name) noexcept {
+    if (Failures() != 0) {
+        fprintf(stderr, "%s: проваленных проверок - %d\n", name, Failures());
+        return 1;
+    }
+    printf("%s: ok\n", name);
+    return 0;
+}
+
+// Экспорт синтетического образа; ординал = база + позиция в списке
+struct SyntheticExport {
+    std::string name;       // Пустое - экспорт только по ординалу
+    UInt32 rva = 0;         // 0 - пустая ячейка таблицы функций
+    std::string forwarder;  // Непустое - форвардер "MODULE.Func" (rva не используется)
+};
+
+// Дополнительное имя уже существующей функции (имён может быть больше,
+// чем функций: индекс в AddressOfNameOrdinals 16-битный)
+struct SyntheticAlias {
+    std::string name;
+    UInt16 function_index;
+};
+
+// Образ: [0, 0x1000) - заголовки (нули), с 0x1000 - каталог экспортов
+// с таблицами и строками, дальше - пустое место под "код" экспортов
+class SyntheticImage {
+public:
+    static constexpr UInt32 kDirectoryRva = 0x1000;
+
+    // sort_names == false - имена в порядке экспортов, затем псевдонимов
+    // (таблица, не отсортированная линкером)
+    explicit SyntheticImage(const std::vector<SyntheticExport>& exports, UInt32 ordinal_base = 1,
+                            const std::vector<SyntheticAlias>& aliases = {}, bool sort_names = true) {
+        // Таблица имён отсортирована, как у линкера
+        std::vector<SyntheticAlias> named;
+        for (UInt32 i = 0; i < exports.size(); ++i) {
+            if (!exports[i].name.empty()) {
+                named.push_back(SyntheticAlias{exports[i].name, static_cast<UInt16>(i)});
+            }
+        }
+        named.insert(named.end(), aliases.begin(), aliases.end());
+        if (sort_names) {
+            std::stable_sort(named.begin(), named.end(), [](const SyntheticAlias& left, const SyntheticAlias& right) {
+                return left.name < right.name;
+            });
+        }
+
+        auto count = static_cast<UInt32>(exports.size());
+        auto name_count = static_cast<UInt32>(named.size());
+        UInt32 functions = kDirectoryRva + sizeof(RawExportDirectory);
+        UInt32 names = functions + 4 * count;
+        UInt32 ordinals = names + 4 * name_count;
+        UInt32 strings = ordinals + 2 * name_count;
+
+        size_t directory_end = strings;
+        UInt32 highest_rva = 0;
+        for (const auto& entry : named) {
+            directory_end += entry.name.size() + 1;
+        }
+        for (const auto& entry : exports) {
+            directory_end += entry.forwarder.size() + 1;
+            highest_rva = std::max(highest_rva, entry.rva);
+        }
+
+        directory_size_ = static_cast<UInt32>(directory_end - kDirectoryRva);
+        size_t size = std::max<size_t>(directory_end, static_cast<size_t>(highest_rva) + 16);
+        bytes_.assign((size + 0xFFF) & ~static_cast<size_t>(0xFFF), 0);
+
+        RawExportDirectory directory{};
+        directory.Base = ordinal_base;
+        directory.NumberOfFunctions = count;
+        directory.NumberOfNames = name_count;
+        directory.AddressOfFunctions = functions;
+        directory.AddressOfNames = names;
+        directory.AddressOfNameOrdinals = ordinals;
+        memcpy(&bytes_[kDirectoryRva], &directory, sizeof(directory));
+
+        UInt32 cursor = strings;
+        for (UInt32 i = 0; i < name_count; ++i) {
+            Put<UInt32>(names + 4 * i, cursor);
+            Put<UInt16>(ordinals + 2 * i, named[i].function_index);
+            cursor = PutString(cursor, named[i].name);
+        }
+
+        for (UInt32 i = 0; i < count; ++i) {
+            if (exports[i].forwarder.empty()) {
+                Put<UInt32>(functions + 4 * i, exports[i].rva);
+            } else {
+                Put<UInt32>(functions + 4 * i, cursor);
+                cursor = PutString(cursor, exports[i].forwarder);
+            }
+        }
+    }
+
+    bool ReadDirectory(ExportDirectory& directory) const noexcept {
+        return ExportDirectory::Read(bytes_.data(), bytes_.size(), kDirectoryRva, directory_size_, directory);
+    }
+
+    // Файл PE32+ (DLL) с одной секцией .edata на месте образа с kDirectoryRva:
+    // раскладка, которую читает ImageLayout::Parse/Map
+    std::vector<UInt8> PeFile(UInt32 time_date_stamp = 0, UInt32 checksum = 0) const {
+        constexpr UInt32 kLfanew = 0x40;
+        constexpr UInt32 kFileHeader = kLfanew + 4;
+        constexpr UInt32 kOptional = kFileHeader + 20;
+        constexpr UInt16 kOptionalSize = 240;
+        constexpr UInt32 kSectionTable = kOptional + kOptionalSize;
+        constexpr UInt32 kHeadersSize = 0x400;
+        
+        auto section_size = static_cast<UInt32>(bytes_.size() - kDirectoryRva);
+        std::vector<UInt8> file(kHeadersSize + section_size, 0);
+        auto put = [&file](UInt32 offset, auto value) { memcpy(&file[offset], &value, sizeof(value)); };
+        
+        put(0, static_cast<UInt16>(0x5A4D));                    // "MZ"
+        put(0x3C, kLfanew);
+        put(kLfanew, static_cast<UInt32>(0x00004550));          // "PE\0\0"
+        
+        put(kFileHeader + 0, static_cast<UInt16>(0x8664));      // AMD64
+        put(kFileHeader + 2, static_cast<UInt16>(1));
+        put(kFileHeader + 4, time_date_stamp);
+        put(kFileHeader + 16, kOptionalSize);
+        put(kFileHeader + 18, static_cast<UInt16>(0x2022));     // DLL | EXECUTABLE | LARGE_ADDRESS_AWARE
+        
+        put(kOptional + 0, static_cast<UInt16>(0x20B));         // PE32+
+        put(kOptional + 24, static_cast<UInt64>(0x180000000ull));
+        put(kOptional + 32, static_cast<UInt32>(0x1000));
+        put(kOptional + 36, static_cast<UInt32>(0x200));
+        put(kOptional + 56, static_cast<UInt32>(bytes_.size()));
+        put(kOptional + 60, kHeadersSize);
+        put(kOptional + 64, checksum);
+        put(kOptional + 108, static_cast<UInt32>(16));
+        put(kOptional + 112, kDirectoryRva);                    // DataDirectory[EXPORT]
+        put(kOptional + 116, directory_size_);
+        
+        memcpy(&file[kSectionTable], ".edata", 6);
+        put(kSectionTable + 8, section_size);
+        put(kSectionTable + 12, kDirectoryRva);
+        put(kSectionTable + 16, section_size);
+        put(kSectionTable + 20, kHeadersSize);
+        put(kSectionTable + 36, static_cast<UInt32>(0x40000040));  // INITIALIZED_DATA | READ
+        
+        memcpy(&file[kHeadersSize], &bytes_[kDirectoryRva], section_size);
+        return file;
+    }
+    
+    UInt8* Data() noexcept { return bytes_.data(); }
+    const UInt8* Data() const noexcept { return bytes_.data(); }
+    size_t Size() const noexcept { return bytes_.size(); }
+    UInt32 DirectorySize() const noexcept { return directory_size_; }
+
+private:
+    template <typename Value>
+    void Put(UInt32 offset, Value value) noexcept {
+        memcpy(&bytes_[offset], &value, sizeof(value));
+    }
+
+    UInt32 PutString(UInt32 offset, const std::string& text) noexcept {
+        memcpy(&bytes_[offset], text.c_str(), text.size() + 1);
+        return offset + static_cast<UInt32>(text.size()) + 1;
+    }
+
+    std::vector<UInt8> bytes_;
+    UInt32 directory_size_ = 0;
+};
+
+// count экспортов "<prefix><i>" с RVA 0x10000 + 16 * i
+inline std::vector<SyntheticExport> NumberedExports(UInt32 count, const std::string& prefix = "Function_") {
+    std::vector<SyntheticExport> exports(count);
+    for (UInt32 i = 0; i < count; ++i) {
+        exports[i].name = prefix + std::to_string(i);
+        exports[i].rva = 0x10000 + 16 * i;
+    }
+    return exports;
+}
+
+} // namespace Test
+} // namespace MemoryModule
+
+#define XMEMMOD_CHECK(expression) \
+    ::MemoryModule::Test::Check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
@@ -0,0 +1,155 @@
+﻿/**
+ * @file xMemModThunksTest.cpp
+ * @brief MemoryModule - Тесты переходников со счётчиками вызовов
+ * @details Переходники x64 исполняются (только x86-64 с mmap), для x86
+ *          проверяется сгенерированный код.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModTest.h"
+#include "xMemModThunks.h"
+
+#include <thread>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace MemoryModule;
+
+namespace {
+
+int AddOne(int value) {
+    return value + 1;
+}
+
+double Scale(double value, int factor) {
+    return value * factor;
+}
+
+// Блок под переходники; после Build код переводится в чтение и исполнение
+class ThunkMemory {
+public:
+    explicit ThunkMemory(size_t count)
+        : page_(static_cast<size_t>(sysconf(_SC_PAGESIZE)))
+        , size_(CallCounters::RequiredSize(count, page_))
+        , code_size_(CallCounters::CodeSize(count, page_)) {
+        void* memory = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        memory_ = memory == MAP_FAILED ? nullptr : memory;
+    }
+    
+    ~ThunkMemory() {
+        if (memory_) {
+            munmap(memory_, size_);
+        }
+    }
+    
+    bool Build(CallCounters& counters, const void* const* targets, size_t count, ThunkArch arch) {
+        return memory_ && counters.Build(memory_, size_, page_, targets, count, arch);
+    }
+    
+    bool Seal() {
+        return mprotect(memory_, code_size_, PROT_READ | PROT_EXEC) == 0;
+    }
+
+private:
+    size_t page_;
+    size_t size_;
+    size_t code_size_;
+    void* memory_ = nullptr;
+};
+
+// Переходник прозрачен для аргументов и результата, считает вызовы из
+// нескольких потоков, пропускает пустые цели
+void TestX64Counting() {
+    const void* targets[] = {reinterpret_cast<const void*>(&AddOne), nullptr,
+                             reinterpret_cast<const void*>(&Scale)};
+    
+    ThunkMemory memory(3);
+    CallCounters counters;
+    if (!XMEMMOD_CHECK(memory.Build(counters, targets, 3, ThunkArch::X64)) || !XMEMMOD_CHECK(memory.Seal())) {
+        return;
+    }
+    
+    XMEMMOD_CHECK(counters.ThunkAt(1) == nullptr);
+    XMEMMOD_CHECK(counters.ThunkAt(3) == nullptr);
+    
+    auto add_one = reinterpret_cast<int (*)(int)>(const_cast<void*>(counters.ThunkAt(0)));
+    auto scale = reinterpret_cast<double (*)(double, int)>(const_cast<void*>(counters.ThunkAt(2)));
+    XMEMMOD_CHECK(add_one(41) == 42);
+    XMEMMOD_CHECK(scale(1.5, 4) == 6.0);
+    XMEMMOD_CHECK(counters.CountAt(0) == 1 && counters.CountAt(1) == 0 && counters.CountAt(2) == 1);
+    
+    // Потоки попадают в разные полосы; сумма не теряет вызовов
+    constexpr int kThreads = 4;
+    constexpr int kCalls = 100000;
+    std::vector<std::thread> threads;
+    int results[kThreads] = {};
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([add_one, &results, t] {
+            int value = 0;
+            for (int i = 0; i < kCalls; ++i) {
+                value = add_one(value);
+            }
+            results[t] = value;
+        });
+    }
+    for (int t = 0; t < kThreads; ++t) {
+        threads[t].join();
+        XMEMMOD_CHECK(results[t] == kCalls);
+    }
+    XMEMMOD_CHECK(counters.CountAt(0) == 1 + static_cast<UInt64>(kThreads) * kCalls);
+    
+    counters.Reset();
+    XMEMMOD_CHECK(counters.CountAt(0) == 0 && counters.CountAt(2) == 0);
+    XMEMMOD_CHECK(add_one(1) == 2 && counters.CountAt(0) == 1);
+}
+
+// x86: 64-битный инкремент циклом lock cmpxchg8b, регистры (в том числе eax
+// с первым аргументом register/regparm) восстанавливаются до перехода
+void TestX86Code() {
+    const void* targets[] = {reinterpret_cast<const void*>(&AddOne)};
+    
+    ThunkMemory memory(1);
+    CallCounters counters;
+    if (!XMEMMOD_CHECK(memory.Build(counters, targets, 1, ThunkArch::X86))) {
+        return;
+    }
+    
+    const auto* code = static_cast<const UInt8*>(counters.ThunkAt(0));
+    auto dword = [code](size_t offset) {
+        UInt32 value = 0;
+        memcpy(&value, code + offset, sizeof(value));
+        return value;
+    };
+    
+    // push eax, ebx, ecx, edx, esi
+    XMEMMOD_CHECK(code[0] == 0x50 && code[1] == 0x53 && code[2] == 0x51 && code[3] == 0x52 && code[4] == 0x56);
+    // mov esi, esp; shr esi, 20; and esi, 7; imul esi, esi, stride; add esi, counter
+    XMEMMOD_CHECK(code[5] == 0x89 && code[6] == 0xE6 && code[7] == 0xC1 && code[10] == 0x83 && code[13] == 0x69);
+    XMEMMOD_CHECK(dword(15) == 64);
+    XMEMMOD_CHECK(code[19] == 0x81 && code[20] == 0xC6);
+    // retry: ... lock cmpxchg8b qword [esi]; jnz retry
+    XMEMMOD_CHECK(code[30] == 0x89 && code[31] == 0xC3);
+    XMEMMOD_CHECK(code[40] == 0xF0 && code[41] == 0x0F && code[42] == 0xC7 && code[43] == 0x0E);
+    XMEMMOD_CHECK(code[44] == 0x75 && 46 + static_cast<int8_t>(code[45]) == 30);
+    // pop в обратном порядке - стек на переходе тот же, что на входе
+    XMEMMOD_CHECK(code[46] == 0x5E && code[47] == 0x5A && code[48] == 0x59 && code[49] == 0x5B && code[50] == 0x58);
+    // jmp dword [target], дальше - заполнение int3
+    XMEMMOD_CHECK(code[51] == 0xFF && code[52] == 0x25);
+    for (size_t i = 57; i < CallCounters::kThunkSize; ++i) {
+        XMEMMOD_CHECK(code[i] == 0xCC);
+    }
+}
+
+} // namespace
+
+int main() {
+    TestX64Counting();
+    TestX86Code();
+    return Test::Finish("xMemModThunksTest");
+}
@@ -14,6 +14,8 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <utility>
+#include <thread>
 
 namespace MemoryModule {
 
@@ -24,6 +26,22 @@ namespace MemoryModule {
     constexpr WORD HOST_MACHINE = IMAGE_FILE_MACHINE_I386;
 #endif
 
+// Резолвер форвардеров по умолчанию: системный загрузчик
+static const void* DefaultForwarderResolver(const ForwarderTarget& target) {
+    std::string module(target.module);
+    HMODULE handle = LoadLibraryA(module.c_str());
+    if (!handle) {
+        return nullptr;
+    }
+    
+    if (target.by_ordinal) {
+        return reinterpret_cast<const void*>(::GetProcAddress(handle, MAKEINTRESOURCEA(target.ordinal)));
+    }
+    
+    std::string symbol(target.symbol);
+    return reinterpret_cast<const void*>(::GetProcAddress(handle, symbol.c_str()));
+}
+
 // Конструктор
 MemoryModule::MemoryModule() noexcept
     : code_base_(nullptr)
@@ -31,7 +49,14 @@ MemoryModule::MemoryModule() noexcept
     , headers_(nullptr, [](IMAGE_NT_HEADERS*) {})
     , is_loaded_(false)
     , is_64bit_(false)
-    , export_list_built_(false)
+    , generation_(1)
+    , storage_(ImageStorage::Allocated)
+    , export_table_(nullptr)
+    , name_order_(NameOrder::Unknown)
+    , forwarder_resolver_(DefaultForwarderResolver)
+    , forwarder_scope_(kDefaultForwarderScope)
+    , mapped_index_view_(nullptr)
+    , call_counter_memory_(nullptr)
     , page_size_(0) {
     
     SYSTEM_INFO sys_info;
@@ -42,6 +67,11 @@ MemoryModule::MemoryModule() noexcept
 // Деструктор
 MemoryModule::~MemoryModule() noexcept {
     Unload();
+    
+    // Результаты собственного резолвера больше никому не нужны
+    if (forwarder_scope_ != kDefaultForwarderScope) {
+        ForwarderCache::Instance().InvalidateScope(forwarder_scope_);
+    }
 }
 
 // Move конструктор
@@ -51,9 +81,26 @@ MemoryModule::MemoryModule(MemoryModule&& other) noexcept
     , headers_(std::move(other.headers_))
     , is_loaded_(other.is_loaded_.exchange(false))
     , is_64bit_(other.is_64bit_.exchange(false))
-    , export_list_(std::move(other.export_list_))
-    , export_list_built_(other.export_list_built_.exchange(false))
+    , generation_(1)
+    , storage_(std::exchange(other.storage_, ImageStorage::Allocated))
+    , export_table_(other.export_table_.exchange(nullptr))
+    , name_order_(other.name_order_.exchange(NameOrder::Unknown))
+    , forwarder_resolver_(other.forwarder_resolver_)   // копия: перемещённый модуль может загружаться снова
+    , forwarder_scope_(std::exchange(other.forwarder_scope_, kDefaultForwarderScope))
+    , mapped_index_(other.mapped_index_)
+    , mapped_index_view_(std::exchange(other.mapped_index_view_, nullptr))
+    , call_counters_(other.call_counters_)
+    , call_counter_memory_(std::exchange(other.call_counter_memory_, nullptr))
+    , copy_options_(other.copy_options_)
+    , relocation_options_(other.relocation_options_)
     , page_size_(std::exchange(other.page_size_, 0)) {
+    other.mapped_index_.Detach();
+    other.call_counters_.Clear();
+    // Копия собственного резолвера - со своей областью кэша
+    if (forwarder_scope_ != kDefaultForwarderScope) {
+        other.forwarder_scope_ = ForwarderCache::NewScope();
+    }
+    other.generation_.fetch_add(1, std::memory_order_release);
 }
 
 // Move оператор присваивания
@@ -66,9 +113,30 @@ MemoryModule& MemoryModule::operator=(MemoryModule&& other) noexcept {
         headers_ = std::move(other.headers_);
         is_loaded_ = other.is_loaded_.exchange(false);
         is_64bit_ = other.is_64bit_.exchange(false);
-        export_list_ = std::move(other.export_list_);
-        export_list_built_ = other.export_list_built_.exchange(false);
+        storage_ = std::exchange(other.storage_, ImageStorage::Allocated);
+        export_table_.store(other.export_table_.exchange(nullptr));
+        name_order_ = other.name_order_.exchange(NameOrder::Unknown);
+        forwarder_resolver_ = other.forwarder_resolver_;   // копия: other может загружаться снова
+        if (forwarder_scope_ != kDefaultForwarderScope) {
+            ForwarderCache::Instance().InvalidateScope(forwarder_scope_);
+        }
+        forwarder_scope_ = std::exchange(other.forwarder_scope_, kDefaultForwarderScope);
+        if (forwarder_scope_ != kDefaultForwarderScope) {
+            other.forwarder_scope_ = ForwarderCache::NewScope();
+        }
+        mapped_index_ = other.mapped_index_;
+        mapped_index_view_ = std::exchange(other.mapped_index_view_, nullptr);
+        other.mapped_index_.Detach();
+        call_counters_ = other.call_counters_;
+        call_counter_memory_ = std::exchange(other.call_counter_memory_, nullptr);
+        other.call_counters_.Clear();
+        copy_options_ = other.copy_options_;
+        relocation_options_ = other.relocation_options_;
         page_size_ = std::exchange(other.page_size_, 0);
+        
+        // Содержимое сменилось у обоих объектов
+        generation_.fetch_add(1, std::memory_order_release);
+        other.generation_.fetch_add(1, std::memory_order_release);
     }
     return *this;
 }
@@ -89,6 +157,296 @@ bool MemoryModule::LoadFromMemory(const void* data, size_t size) noexcept {
         }
         
         is_loaded_.store(true);
+        generation_.fetch_add(1, std::memory_order_release);
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Загрузка из файла по пути
+bool MemoryModule::LoadFromFile(const char* path) noexcept {
+    if (!path) {
+        return false;
+    }
+    
+    // Право на исполнение нужно только для загрузки без копирования
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_EXECUTE, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL, nullptr);
+    }
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    
+    bool loaded = LoadFromHandle(file);
+    CloseHandle(file);
+    return loaded;
+}
+
+// Загрузка из открытого файла
+bool MemoryModule::LoadFromHandle(HANDLE file) noexcept {
+    try {
+        if (!file || file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        
+        Unload();
+        
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0 ||
+            static_cast<UInt64>(file_size.QuadPart) > SIZE_MAX) {
+            return false;
+        }
+        size_t size = static_cast<size_t>(file_size.QuadPart);
+        
+        // Исполняемое отображение с копированием при записи; без права
+        // на исполнение - только чтение и обычная загрузка с копированием
+        bool executable = true;
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_EXECUTE_WRITECOPY, 0, 0, nullptr);
+        if (!mapping) {
+            executable = false;
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        }
+        if (!mapping) {
+            return false;
+        }
+        
+        // Отображение держит файл открытым, дескриптор больше не нужен
+        void* view = MapViewOfFile(mapping, executable ? (FILE_MAP_COPY | FILE_MAP_EXECUTE) : FILE_MAP_READ,
+                                   0, 0, 0);
+        CloseHandle(mapping);
+        
+        if (!view) {
+            return false;
+        }
+        
+        // Хвост последней страницы отображения заполнен нулями и принадлежит ему
+        size_t view_size = AlignValue(size, page_size_);
+        
+        bool loaded = false;
+        if (executable && IsMappedLayout(view, view_size)) {
+            // Отображение становится образом и освобождается в Unload
+            loaded = LoadPEInPlace(view, view_size, ImageStorage::FileView);
+        } else {
+            loaded = LoadPE(view, size);
+            UnmapViewOfFile(view);
+        }
+        
+        if (!loaded) {
+            return false;
+        }
+        
+        is_loaded_.store(true);
+        generation_.fetch_add(1, std::memory_order_release);
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Загрузка образа, уже разложенного по RVA, без копирования секций
+bool MemoryModule::LoadFromMappedLayout(void* image, size_t size, Ownership ownership) noexcept {
+    try {
+        Unload();
+        
+        // Защита страниц меняется по секциям - чужие данные на страницах недопустимы.
+        // Невыровненный буфер не мог прийти из VirtualAlloc: владение им не принимается
+        if (!image || reinterpret_cast<uintptr_t>(image) % page_size_ != 0) {
+            return false;
+        }
+        
+        if (!LoadPEInPlace(image, size,
+                           ownership == Ownership::Adopt ? ImageStorage::Allocated : ImageStorage::Borrowed)) {
+            // Принятый буфер освобождается и при ошибке: либо через Unload
+            // (модуль уже владеет им), либо здесь (проверка не пройдена)
+            if (code_base_ == image) {
+                Unload();
+            } else if (ownership == Ownership::Adopt) {
+                VirtualFree(image, 0, MEM_RELEASE);
+            }
+            return false;
+        }
+        
+        is_loaded_.store(true);
+        generation_.fetch_add(1, std::memory_order_release);
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Освобождение буфера образа
+void ImageBufferDeleter::operator()(std::byte* buffer) const noexcept {
+    if (buffer) {
+        VirtualFree(buffer, 0, MEM_RELEASE);
+    }
+}
+
+// Выделение буфера образа: VirtualAlloc выравнивает его на страницу
+ImageBuffer MemoryModule::AllocateImageBuffer(size_t capacity) noexcept {
+    if (capacity == 0) {
+        return nullptr;
+    }
+    return ImageBuffer(static_cast<std::byte*>(
+        VirtualAlloc(nullptr, capacity, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE)));
+}
+
+// Загрузка из буфера во владении модуля
+bool MemoryModule::LoadFromOwnedBuffer(ImageBuffer buffer, size_t size, size_t capacity) noexcept {
+    if (!buffer) {
+        Unload();
+        return false;
+    }
+    
+    // Невыровненный буфер копируется; освобождается после копирования
+    if (reinterpret_cast<uintptr_t>(buffer.get()) % page_size_ != 0) {
+        return LoadFromMemory(buffer.get(), size);
+    }
+    
+    // Буфер из VirtualAlloc - дальше им владеет модуль как собственным образом
+    return LoadExpanded(buffer.release(), size, capacity, ImageStorage::Allocated);
+}
+
+// Загрузка из буфера с явным владением
+bool MemoryModule::LoadFromOwnedBuffer(void* buffer, size_t size, size_t capacity, Ownership ownership) noexcept {
+    if (buffer && reinterpret_cast<uintptr_t>(buffer) % page_size_ != 0) {
+        // Невыровненный буфер не мог прийти из VirtualAlloc: владение им не принимается
+        if (ownership == Ownership::Adopt) {
+            Unload();
+            return false;
+        }
+        
+        // На месте нельзя (защита меняется постранично) - копируем, буфер не трогаем
+        return LoadFromMemory(buffer, size);
+    }
+    
+    return LoadExpanded(buffer, size, capacity,
+                        ownership == Ownership::Adopt ? ImageStorage::Allocated : ImageStorage::Borrowed);
+}
+
+// Общая часть: развёртывание файла в образ на месте и загрузка без копирования.
+// Буфер выровнен на страницу (проверяет вызывающий)
+bool MemoryModule::LoadExpanded(void* buffer, size_t size, size_t capacity, ImageStorage storage) noexcept {
+    try {
+        Unload();
+        
+        bool loaded = false;
+        if (buffer && ExpandInPlace(buffer, size, capacity)) {
+            loaded = LoadPEInPlace(buffer, capacity, storage);
+        }
+        
+        if (!loaded) {
+            // Принятый буфер освобождается и при ошибке
+            if (code_base_ == buffer && buffer) {
+                Unload();
+            } else if (storage == ImageStorage::Allocated && buffer) {
+                VirtualFree(buffer, 0, MEM_RELEASE);
+            }
+            return false;
+        }
+        
+        is_loaded_.store(true);
+        generation_.fetch_add(1, std::memory_order_release);
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Перенос секций файла на их RVA внутри того же буфера. Сначала проверяется
+// всё, что нужно для переноса и для LoadPEInPlace - после первого memmove
+// отступать уже некуда.
+bool MemoryModule::ExpandInPlace(void* buffer, size_t size, size_t capacity) const noexcept {
+    try {
+        if (size > capacity || !IsValidPE(buffer, size)) {
+            return false;
+        }
+        
+        auto* base = static_cast<unsigned char*>(buffer);
+        const IMAGE_DOS_HEADER* dos_header = static_cast<const IMAGE_DOS_HEADER*>(buffer);
+        auto* headers = reinterpret_cast<IMAGE_NT_HEADERS*>(base + dos_header->e_lfanew);
+        
+        if (!IsSupportedArchitecture(headers)) {
+            return false;
+        }
+        
+        const auto& optional = headers->OptionalHeader;
+        size_t image_size = optional.SizeOfImage;
+        size_t headers_size = optional.SizeOfHeaders;
+        if (optional.SectionAlignment < page_size_ || AlignValue(image_size, page_size_) > capacity ||
+            headers_size > size || headers_size > image_size) {
+            return false;
+        }
+        
+        size_t table_offset = static_cast<size_t>(dos_header->e_lfanew) + offsetof(IMAGE_NT_HEADERS, OptionalHeader) +
+                              headers->FileHeader.SizeOfOptionalHeader;
+        size_t table_size = static_cast<size_t>(headers->FileHeader.NumberOfSections) * sizeof(IMAGE_SECTION_HEADER);
+        if (table_offset + table_size > headers_size) {
+            return false;
+        }
+        
+        // Секции по возрастанию RVA
+        std::vector<IMAGE_SECTION_HEADER*> sections;
+        sections.reserve(headers->FileHeader.NumberOfSections);
+        IMAGE_SECTION_HEADER* section = IMAGE_FIRST_SECTION(headers);
+        for (UInt16 i = 0; i < headers->FileHeader.NumberOfSections; ++i, ++section) {
+            sections.push_back(section);
+        }
+        std::sort(sections.begin(), sections.end(), [](const IMAGE_SECTION_HEADER* a, const IMAGE_SECTION_HEADER* b) {
+            return a->VirtualAddress < b->VirtualAddress;
+        });
+        
+        // Перенос от последней секции к первой безопасен, если данные в файле
+        // идут в том же порядке и каждая секция сдвигается только вперёд
+        std::vector<size_t> copy_sizes(sections.size());
+        size_t previous_end = headers_size;
+        size_t previous_raw_end = 0;
+        for (size_t i = 0; i < sections.size(); ++i) {
+            const IMAGE_SECTION_HEADER* current = sections[i];
+            size_t rva = current->VirtualAddress;
+            size_t next = i + 1 < sections.size() ? sections[i + 1]->VirtualAddress : image_size;
+            
+            if (rva % page_size_ != 0 || rva < previous_end || next < rva || rva > image_size ||
+                current->Misc.VirtualSize > image_size - rva) {
+                return false;
+            }
+            
+            copy_sizes[i] = std::min<size_t>(current->SizeOfRawData, next - rva);
+            if (copy_sizes[i] != 0) {
+                size_t raw = current->PointerToRawData;
+                if (raw > rva || raw < previous_raw_end || raw < headers_size || raw > size || copy_sizes[i] > size - raw) {
+                    return false;
+                }
+                previous_raw_end = raw + copy_sizes[i];
+            }
+            previous_end = rva;
+        }
+        
+        // Перенос и обнуление промежутков, от последней секции к первой
+        for (size_t i = sections.size(); i-- > 0;) {
+            IMAGE_SECTION_HEADER* current = sections[i];
+            size_t rva = current->VirtualAddress;
+            size_t next = i + 1 < sections.size() ? sections[i + 1]->VirtualAddress : image_size;
+            
+            if (copy_sizes[i] != 0 && current->PointerToRawData != rva) {
+                memmove(base + rva, base + current->PointerToRawData, copy_sizes[i]);
+            }
+            memset(base + rva + copy_sizes[i], 0, next - rva - copy_sizes[i]);
+            
+            // Заголовок описывает уже разложенный образ
+            current->PointerToRawData = copy_sizes[i] != 0 ? static_cast<DWORD>(rva) : 0;
+            current->SizeOfRawData = static_cast<DWORD>(copy_sizes[i]);
+        }
+        
+        size_t first = sections.empty() ? image_size : sections.front()->VirtualAddress;
+        memset(base + headers_size, 0, first - headers_size);
         return true;
         
     } catch (...) {
@@ -103,17 +461,31 @@ FARPROC MemoryModule::GetProcAddress(const char* name) const noexcept {
             return nullptr;
         }
         
-        // Сначала пытаемся найти по имени
-        auto exports = GetExportList();
-        for (const auto& exp : exports) {
-            if (exp.name == name) {
-                return exp.address;
+        // Сначала ищем по имени: через хеш-индекс, если он уже построен,
+        // затем через отображённый файл индекса, иначе двоичным поиском
+        // прямо по таблице имён образа
+        if (const ExportTable* table = export_table_.load(std::memory_order_acquire)) {
+            UInt32 slot = table->index.Find(name);
+            if (slot != ExportIndex::kNotFound) {
+                return CountedAddress(table->index.FunctionIndexAt(slot),
+                                      ResolveExportAddress(table->directory, table->RvaAt(slot), table->AddressAt(slot)));
+            }
+        } else if (mapped_index_.IsAttached()) {
+            UInt32 function_index = mapped_index_.Find(name);
+            if (function_index != MappedExportIndex::kNotFound) {
+                const ExportDirectory& directory = mapped_index_.Directory();
+                UInt32 rva = directory.functions[function_index];
+                if (rva != 0 && rva < image_size_) {
+                    return ResolveExportAddress(directory, rva, static_cast<char*>(code_base_) + rva);
+                }
             }
+        } else if (FARPROC address = FindProcWithoutIndex(name)) {
+            return address;
         }
         
         // Если не найдено по имени, пытаемся найти по ординалу
         if (std::all_of(name, name + strlen(name), ::isdigit)) {
-            UInt16 ordinal = static_cast<UInt16>(std::stoi(name));
+            UInt32 ordinal = static_cast<UInt32>(std::stoul(name));
             return GetProcAddressByOrdinal(ordinal);
         }
         
@@ -124,15 +496,195 @@ FARPROC MemoryModule::GetProcAddress(const char* name) const noexcept {
     }
 }
 
+// Получение адреса функции по заранее посчитанному ключу
+FARPROC MemoryModule::GetProcAddress(const SymbolKey& key) const noexcept {
+    try {
+        if (!IsValid() || !key.name) {
+            return nullptr;
+        }
+        
+        // Отображённый файл индекса избавляет от построения таблицы
+        if (!export_table_.load(std::memory_order_acquire) && mapped_index_.IsAttached()) {
+            UInt32 function_index = mapped_index_.Find(key);
+            if (function_index == MappedExportIndex::kNotFound) {
+                return nullptr;
+            }
+            
+            const ExportDirectory& directory = mapped_index_.Directory();
+            UInt32 rva = directory.functions[function_index];
+            if (rva == 0 || rva >= image_size_) {
+                return nullptr;
+            }
+            return ResolveExportAddress(directory, rva, static_cast<char*>(code_base_) + rva);
+        }
+        
+        const ExportTable& table = GetExportTable();
+        
+        // Хеш уже известен: пробируем индекс, строку сравниваем только при совпадении тега
+        UInt32 slot = table.index.Find(key);
+        if (slot == ExportIndex::kNotFound) {
+            return nullptr;
+        }
+        
+        return CountedAddress(table.index.FunctionIndexAt(slot),
+                              ResolveExportAddress(table.directory, table.RvaAt(slot), table.AddressAt(slot)));
+        
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+// Поиск функции по идентификатору интернированного имени
+FARPROC MemoryModule::GetProcAddressById(SymbolId id) const noexcept {
+    SymbolKey key = SymbolPool::Instance().Key(id);
+    return key.length != 0 ? GetProcAddress(key) : nullptr;
+}
+
+// Пакетное разрешение имён
+size_t MemoryModule::ResolveMany(const char* const* names, FARPROC* out, size_t count) const noexcept {
+    try {
+        if (!out) {
+            return 0;
+        }
+        
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = nullptr;
+        }
+        
+        if (!IsValid() || !names) {
+            return 0;
+        }
+        
+        const ExportTable& table = GetExportTable();
+        
+        // Слоты - в буфере на стеке, чтобы не выделять память
+        constexpr size_t kChunk = 64;
+        UInt32 slots[kChunk];
+        size_t resolved = 0;
+        
+        for (size_t start = 0; start < count; start += kChunk) {
+            size_t chunk = (count - start < kChunk) ? count - start : kChunk;
+            table.index.FindMany(names + start, slots, chunk);
+            
+            for (size_t i = 0; i < chunk; ++i) {
+                if (slots[i] != ExportIndex::kNotFound) {
+                    out[start + i] = CountedAddress(table.index.FunctionIndexAt(slots[i]),
+                                                    ResolveExportAddress(table.directory, table.RvaAt(slots[i]),
+                                                                         table.AddressAt(slots[i])));
+                } else if (names[start + i]) {
+                    // Промах: та же логика, что и в GetProcAddress (имя-число = ординал)
+                    out[start + i] = GetProcAddress(names[start + i]);
+                }
+                
+                if (out[start + i]) {
+                    ++resolved;
+                }
+            }
+        }
+        
+        return resolved;
+        
+    } catch (...) {
+        return 0;
+    }
+}
+
+// Пакетное разрешение заранее посчитанных ключей
+size_t MemoryModule::ResolveMany(const SymbolKey* keys, FARPROC* out, size_t count) const noexcept {
+    try {
+        if (!out) {
+            return 0;
+        }
+        
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = nullptr;
+        }
+        
+        if (!IsValid() || !keys) {
+            return 0;
+        }
+        
+        size_t resolved = 0;
+        
+        // С подключённым файлом индекса таблицу не строим
+        if (!export_table_.load(std::memory_order_acquire) && mapped_index_.IsAttached()) {
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = GetProcAddress(keys[i]);
+                resolved += out[i] ? 1 : 0;
+            }
+            return resolved;
+        }
+        
+        const ExportTable& table = GetExportTable();
+        
+        constexpr size_t kChunk = 64;
+        UInt32 slots[kChunk];
+        
+        for (size_t start = 0; start < count; start += kChunk) {
+            size_t chunk = (count - start < kChunk) ? count - start : kChunk;
+            table.index.FindMany(keys + start, slots, chunk);
+            
+            for (size_t i = 0; i < chunk; ++i) {
+                if (slots[i] != ExportIndex::kNotFound) {
+                    out[start + i] = CountedAddress(table.index.FunctionIndexAt(slots[i]),
+                                                    ResolveExportAddress(table.directory, table.RvaAt(slots[i]),
+                                                                         table.AddressAt(slots[i])));
+                    resolved += out[start + i] ? 1 : 0;
+                }
+            }
+        }
+        
+        return resolved;
+        
+    } catch (...) {
+        return 0;
+    }
+}
+
 // Получение списка всех экспортов с готовыми указателями
 std::vector<ExportInfo> MemoryModule::GetExportList() const noexcept {
-    std::lock_guard<std::mutex> lock(export_mutex_);
+    try {
+        const ExportTable& table = GetExportTable();
+        
+        std::vector<ExportInfo> exports;
+        exports.reserve(table.view.Size());
+        for (const auto& entry : table.view) {
+            exports.push_back(CreateExportInfo(entry.ordinal, entry.rva, table.ordinals.Base(),
+                                               static_cast<UInt32>(reinterpret_cast<uintptr_t>(entry.address)),
+                                               std::string(entry.name),
+                                               EntryAddress(table, entry)));
+        }
+        
+        return exports;
+        
+    } catch (...) {
+        return {};
+    }
+}
+
+// Представление экспортов без копирования
+const ExportView& MemoryModule::GetExportView() const noexcept {
+    return GetExportTable().view;
+}
+
+// Таблица экспортов: после первого построения - одно чтение с acquire
+const ExportTable& MemoryModule::GetExportTable() const noexcept {
+    static const ExportTable empty_table;
     
-    if (!export_list_built_.load()) {
-        BuildExportTable();
+    const ExportTable* table = export_table_.load(std::memory_order_acquire);
+    if (table) {
+        return *table;
     }
     
-    return export_list_;
+    if (!IsValid()) {
+        return empty_table;
+    }
+    
+    std::lock_guard<std::mutex> lock(export_mutex_);
+    BuildExportTable();
+    
+    table = export_table_.load(std::memory_order_acquire);
+    return table ? *table : empty_table;
 }
 
 // Освобождение ресурсов
@@ -153,19 +705,40 @@ bool MemoryModule::Unload() noexcept {
         }
         
         // Очищаем кэш экспортов
-        export_list_.clear();
-        export_list_built_.store(false);
+        delete export_table_.exchange(nullptr, std::memory_order_acq_rel);
+        DetachExportIndex();
+        
+        // Переходники счётчиков вызовов
+        call_counters_.Clear();
+        if (call_counter_memory_) {
+            VirtualFree(call_counter_memory_, 0, MEM_RELEASE);
+            call_counter_memory_ = nullptr;
+        }
+        
+        // Форвардеры других модулей больше не могут указывать в этот образ
+        ForwarderCache::Instance().Invalidate(code_base_, image_size_);
+        name_order_.store(NameOrder::Unknown);
         
         // Освобождаем память
         if (code_base_) {
-            VirtualFree(code_base_, 0, MEM_RELEASE);
+            if (storage_ == ImageStorage::FileView) {
+                UnmapViewOfFile(code_base_);
+            } else if (storage_ == ImageStorage::Borrowed) {
+                // Буфер возвращается вызывающему в исходном виде доступа
+                DWORD old_protect;
+                VirtualProtect(code_base_, image_size_, PAGE_READWRITE, &old_protect);
+            } else {
+                VirtualFree(code_base_, 0, MEM_RELEASE);
+            }
             code_base_ = nullptr;
         }
+        storage_ = ImageStorage::Allocated;
         
         image_size_ = 0;
         headers_.reset();
         is_loaded_.store(false);
         is_64bit_.store(false);
+        generation_.fetch_add(1, std::memory_order_release);
         
         return true;
         
@@ -186,13 +759,13 @@ std::string MemoryModule::GetModuleName() const noexcept {
             return "";
         }
         
-        auto exports = GetExportList();
-        if (exports.empty()) {
+        const ExportView& view = GetExportView();
+        if (view.Empty()) {
             return "Unknown";
         }
         
         // Возвращаем имя первой экспортируемой функции как имя модуля
-        return exports[0].name;
+        return std::string(view[0].name);
         
     } catch (...) {
         return "";
@@ -202,28 +775,28 @@ std::string MemoryModule::GetModuleName() const noexcept {
 // Получение количества экспортов
 UInt32 MemoryModule::GetExportCount() const noexcept {
     try {
-        auto exports = GetExportList();
-        return static_cast<UInt32>(exports.size());
+        return GetExportView().Size();
     } catch (...) {
         return 0;
     }
 }
 
 // Получение адреса функции по ординалу
-FARPROC MemoryModule::GetProcAddressByOrdinal(UInt16 ordinal) const noexcept {
+FARPROC MemoryModule::GetProcAddressByOrdinal(UInt32 ordinal) const noexcept {
     try {
         if (!IsValid()) {
             return nullptr;
         }
         
-        auto exports = GetExportList();
-        for (const auto& exp : exports) {
-            if (exp.ordinal == ordinal) {
-                return exp.address;
-            }
+        // Плотная таблица: проверка границ и одно чтение
+        const ExportTable& table = GetExportTable();
+        const OrdinalEntry* entry = table.ordinals.Find(ordinal);
+        if (!entry) {
+            return nullptr;
         }
         
-        return nullptr;
+        return CountedAddress(ordinal - table.ordinals.Base(),
+                              ResolveExportAddress(table.directory, entry->rva, entry->address));
         
     } catch (...) {
         return nullptr;
@@ -231,20 +804,24 @@ FARPROC MemoryModule::GetProcAddressByOrdinal(UInt16 ordinal) const noexcept {
 }
 
 // Получение имени функции по ординалу
-std::string MemoryModule::GetFunctionName(UInt16 ordinal) const noexcept {
+std::string MemoryModule::GetFunctionName(UInt32 ordinal) const noexcept {
     try {
         if (!IsValid()) {
             return "";
         }
         
-        auto exports = GetExportList();
-        for (const auto& exp : exports) {
-            if (exp.ordinal == ordinal) {
-                return exp.name;
-            }
+        if (!export_table_.load(std::memory_order_acquire) && mapped_index_.IsAttached()) {
+            size_t length = 0;
+            const char* name = mapped_index_.NameOfFunction(ordinal - mapped_index_.Directory().ordinal_base, &length);
+            return name ? std::string(name, length) : "";
         }
         
-        return "";
+        const OrdinalEntry* entry = GetExportTable().ordinals.Find(ordinal);
+        if (!entry || !entry->name) {
+            return "";
+        }
+        
+        return std::string(entry->name, entry->name_length);
         
     } catch (...) {
         return "";
@@ -252,26 +829,64 @@ std::string MemoryModule::GetFunctionName(UInt16 ordinal) const noexcept {
 }
 
 // Получение ординала функции по имени
-UInt16 MemoryModule::GetFunctionOrdinal(const char* name) const noexcept {
+UInt32 MemoryModule::GetFunctionOrdinal(const char* name) const noexcept {
     try {
         if (!IsValid() || !name) {
             return 0;
         }
         
-        auto exports = GetExportList();
-        for (const auto& exp : exports) {
-            if (exp.name == name) {
-                return static_cast<UInt16>(exp.ordinal);
-            }
+        const ExportTable& table = GetExportTable();
+        
+        UInt32 slot = table.index.Find(name);
+        if (slot == ExportIndex::kNotFound) {
+            return 0;
         }
         
-        return 0;
+        return table.OrdinalAt(slot);
         
     } catch (...) {
         return 0;
     }
 }
 
+// Обратный поиск экспорта по адресу
+bool MemoryModule::FindExportByAddress(const void* address, ExportSymbol& symbol) const noexcept {
+    try {
+        if (!IsValid() || !address) {
+            return false;
+        }
+        
+        uintptr_t base = reinterpret_cast<uintptr_t>(code_base_);
+        uintptr_t target = reinterpret_cast<uintptr_t>(address);
+        if (target < base || target - base >= image_size_) {
+            return false;
+        }
+        
+        UInt32 rva = static_cast<UInt32>(target - base);
+        const ExportTable& table = GetExportTable();
+        if (!table.addresses.Find(rva, table.view, symbol)) {
+            return false;
+        }
+        
+        // Уточняем оценку размера границей секции, содержащей экспорт
+        const IMAGE_SECTION_HEADER* section = IMAGE_FIRST_SECTION(headers_.get());
+        for (UInt16 i = 0; i < headers_->FileHeader.NumberOfSections; ++i, ++section) {
+            UInt32 section_end = section->VirtualAddress + section->Misc.VirtualSize;
+            if (symbol.rva >= section->VirtualAddress && symbol.rva < section_end) {
+                if (symbol.rva + symbol.size > section_end) {
+                    symbol.size = section_end - symbol.rva;
+                }
+                break;
+            }
+        }
+        
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
 // Загрузка PE файла
 bool MemoryModule::LoadPE(const void* data, size_t size) noexcept {
     try {
@@ -335,9 +950,66 @@ bool MemoryModule::LoadPE(const void* data, size_t size) noexcept {
             return false;
         }
         
+        return LinkImage(old_headers->OptionalHeader.ImageBase);
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Загрузка образа, уже разложенного по RVA (секции не копируются)
+bool MemoryModule::LoadPEInPlace(void* image, size_t size, ImageStorage storage) noexcept {
+    try {
+        if (!IsMappedLayout(image, size)) {
+            return false;
+        }
+        
+        const IMAGE_DOS_HEADER* dos_header = static_cast<const IMAGE_DOS_HEADER*>(image);
+        auto* headers = reinterpret_cast<IMAGE_NT_HEADERS*>(static_cast<char*>(image) + dos_header->e_lfanew);
+        
+        is_64bit_.store(headers->FileHeader.Machine == IMAGE_FILE_MACHINE_AMD64);
+        
+        // С этого момента память принадлежит модулю (освобождается в Unload)
+        code_base_ = image;
+        image_size_ = AlignValue(headers->OptionalHeader.SizeOfImage, page_size_);
+        storage_ = storage;
+        
+        UInt64 original_base = headers->OptionalHeader.ImageBase;
+        headers_ = std::unique_ptr<IMAGE_NT_HEADERS, void(*)(IMAGE_NT_HEADERS*)>(
+            headers, [](IMAGE_NT_HEADERS*) {});
+        headers_->OptionalHeader.ImageBase = reinterpret_cast<UInt64>(code_base_);
+        
+        // Хвосты секций (VirtualSize > SizeOfRawData) должны быть нулевыми, как
+        // после копирования; нулевые страницы не трогаем, чтобы не копировать их
+        const IMAGE_SECTION_HEADER* section = IMAGE_FIRST_SECTION(headers);
+        for (UInt16 i = 0; i < headers->FileHeader.NumberOfSections; ++i, ++section) {
+            if (section->Misc.VirtualSize <= section->SizeOfRawData) {
+                continue;
+            }
+            
+            auto* tail = static_cast<unsigned char*>(code_base_) + section->VirtualAddress + section->SizeOfRawData;
+            size_t tail_size = section->Misc.VirtualSize - section->SizeOfRawData;
+            for (size_t offset = 0; offset < tail_size; ++offset) {
+                if (tail[offset] != 0) {
+                    memset(tail + offset, 0, tail_size - offset);
+                    break;
+                }
+            }
+        }
+        
+        return LinkImage(original_base);
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Связывание образа на месте: релокации, импорты, защита, TLS, точка входа
+bool MemoryModule::LinkImage(UInt64 original_base) noexcept {
+    try {
         // Выполняем релокации
         std::ptrdiff_t delta = reinterpret_cast<std::ptrdiff_t>(code_base_) - 
-                              old_headers->OptionalHeader.ImageBase;
+                              static_cast<std::ptrdiff_t>(original_base);
         if (delta != 0) {
             if (!PerformBaseRelocation(delta)) {
                 return false;
@@ -376,6 +1048,9 @@ bool MemoryModule::CopySections(const void* data, const IMAGE_NT_HEADERS* old_he
     try {
         const IMAGE_SECTION_HEADER* section = IMAGE_FIRST_SECTION(old_headers);
         
+        std::vector<CopyRegion> regions;
+        regions.reserve(old_headers->FileHeader.NumberOfSections);
+        
         for (UInt16 i = 0; i < old_headers->FileHeader.NumberOfSections; ++i, ++section) {
             if (section->SizeOfRawData == 0) {
                 continue;
@@ -383,9 +1058,11 @@ bool MemoryModule::CopySections(const void* data, const IMAGE_NT_HEADERS* old_he
             
             void* dest = static_cast<char*>(code_base_) + section->VirtualAddress;
             const void* src = static_cast<const char*>(data) + section->PointerToRawData;
-            memcpy(dest, src, section->SizeOfRawData);
+            regions.push_back(CopyRegion{dest, src, section->SizeOfRawData});
         }
         
+        // Крупные секции - кусками по страницам на нескольких потоках
+        CopyRegions(regions.data(), regions.size(), copy_options_);
         return true;
         
     } catch (...) {
@@ -431,33 +1108,10 @@ bool MemoryModule::PerformBaseRelocation(std::ptrdiff_t delta) noexcept {
             return true;
         }
         
-        auto* reloc = reinterpret_cast<IMAGE_BASE_RELOCATION*>(
-            static_cast<unsigned char*>(code_base_) + reloc_dir->VirtualAddress);
-        auto* reloc_end = reinterpret_cast<IMAGE_BASE_RELOCATION*>(
-            static_cast<unsigned char*>(code_base_) + reloc_dir->VirtualAddress + reloc_dir->Size);
-        
-        while (reloc < reloc_end) {
-            auto* reloc_data = reinterpret_cast<UInt16*>(reloc + 1);
-            auto* reloc_data_end = reinterpret_cast<UInt16*>(
-                reinterpret_cast<unsigned char*>(reloc) + reloc->SizeOfBlock);
-            
-            while (reloc_data < reloc_data_end) {
-                UInt16 type = *reloc_data >> 12;
-                UInt16 offset = *reloc_data & 0xFFF;
-                
-                if (type == IMAGE_REL_BASED_HIGHLOW || type == IMAGE_REL_BASED_DIR64) {
-                    auto* patch_address = reinterpret_cast<std::uintptr_t*>(
-                        static_cast<unsigned char*>(code_base_) + reloc->VirtualAddress + offset);
-                    *patch_address += delta;
-                }
-                
-                ++reloc_data;
-            }
-            
-            reloc = reinterpret_cast<IMAGE_BASE_RELOCATION*>(reloc_data);
-        }
-        
-        return true;
+        // Блоки (по странице) разбираются заранее и применяются независимо,
+        // при большом их числе - на нескольких потоках
+        return ApplyRelocations(static_cast<UInt8*>(code_base_), image_size_, reloc_dir->VirtualAddress,
+                                reloc_dir->Size, static_cast<UInt64>(delta), relocation_options_);
         
     } catch (...) {
         return false;
@@ -525,59 +1179,318 @@ bool MemoryModule::BuildImportTable() noexcept {
     }
 }
 
-// Построение таблицы экспортов
+// Построение таблицы экспортов (вызывается под export_mutex_)
 bool MemoryModule::BuildExportTable() const noexcept {
     try {
-        if (export_list_built_.load()) {
+        if (export_table_.load(std::memory_order_acquire)) {
             return true;
         }
         
-        export_list_.clear();
+        auto table = std::make_unique<ExportTable>();
+        bool result = true;
         
         auto* export_dir = &headers_->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
         
-        if (export_dir->VirtualAddress == 0) {
-            export_list_built_.store(true);
+        if (export_dir->VirtualAddress != 0) {
+            // Хеш-индекс имён, таблица ординалов и столбцы представления
+            ExportDirectory directory;
+            result = ExportDirectory::Read(code_base_, image_size_, export_dir->VirtualAddress,
+                                           export_dir->Size, directory) &&
+                     table->Build(directory);
+        }
+        
+        // Публикуем таблицу (пустую при ошибке разбора) - дальше только чтение
+        export_table_.store(table.release(), std::memory_order_release);
+        return result;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Каталог экспортов и поля заголовков для файла индекса
+bool MemoryModule::ReadExportDirectory(ExportDirectory& directory, ImageFingerprint& fingerprint) const noexcept {
+    if (!IsValid() || !headers_) {
+        return false;
+    }
+    
+    auto* export_dir = &headers_->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+    if (export_dir->VirtualAddress == 0 ||
+        !ExportDirectory::Read(code_base_, image_size_, export_dir->VirtualAddress, export_dir->Size, directory)) {
+        return false;
+    }
+    
+    fingerprint.image_size = headers_->OptionalHeader.SizeOfImage;
+    fingerprint.time_date_stamp = headers_->FileHeader.TimeDateStamp;
+    fingerprint.checksum = headers_->OptionalHeader.CheckSum;
+    return true;
+}
+
+// Ключ содержимого для файла индекса
+UInt64 MemoryModule::GetExportIndexKey() const noexcept {
+    ExportDirectory directory;
+    ImageFingerprint fingerprint;
+    return ReadExportDirectory(directory, fingerprint) ? ExportIndexKey(directory, fingerprint) : 0;
+}
+
+// Запись файла индекса: во временный файл и атомарная замена
+bool MemoryModule::SaveExportIndex(const char* path) const noexcept {
+    try {
+        ExportDirectory directory;
+        ImageFingerprint fingerprint;
+        std::vector<UInt8> data;
+        
+        if (!path || !ReadExportDirectory(directory, fingerprint) ||
+            !BuildExportIndexFile(directory, fingerprint, data)) {
+            return false;
+        }
+        
+        std::string temp_path = std::string(path) + "." + std::to_string(GetCurrentProcessId()) + ".tmp";
+        
+        HANDLE file = CreateFileA(temp_path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        
+        DWORD written = 0;
+        BOOL result = WriteFile(file, data.data(), static_cast<DWORD>(data.size()), &written, nullptr);
+        CloseHandle(file);
+        
+        if (!result || written != data.size() ||
+            !MoveFileExA(temp_path.c_str(), path, MOVEFILE_REPLACE_EXISTING)) {
+            DeleteFileA(temp_path.c_str());
+            return false;
+        }
+        
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Подключение отображённого файла индекса
+bool MemoryModule::AttachExportIndex(const char* path) noexcept {
+    DetachExportIndex();
+    
+    ExportDirectory directory;
+    ImageFingerprint fingerprint;
+    if (!path || !ReadExportDirectory(directory, fingerprint)) {
+        return false;
+    }
+    
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    
+    LARGE_INTEGER file_size;
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 && file_size.QuadPart <= 0xFFFFFFFFll) {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    CloseHandle(file);
+    
+    if (!mapping) {
+        return false;
+    }
+    
+    // Отображение держит файл открытым, дескрипторы больше не нужны
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    
+    if (!view) {
+        return false;
+    }
+    
+    if (!mapped_index_.Attach(view, static_cast<size_t>(file_size.QuadPart), directory, fingerprint)) {
+        UnmapViewOfFile(view);
+        return false;
+    }
+    
+    mapped_index_view_ = view;
+    return true;
+}
+
+// Отключение файла индекса
+void MemoryModule::DetachExportIndex() noexcept {
+    mapped_index_.Detach();
+    
+    if (mapped_index_view_) {
+        UnmapViewOfFile(mapped_index_view_);
+        mapped_index_view_ = nullptr;
+    }
+}
+
+// Поиск по имени без построения индекса (для модулей, из которых берут пару функций)
+FARPROC MemoryModule::FindProcWithoutIndex(const char* name) const noexcept {
+    auto* export_dir = &headers_->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+    if (export_dir->VirtualAddress == 0) {
+        return nullptr;
+    }
+    
+    ExportDirectory directory;
+    if (!ExportDirectory::Read(code_base_, image_size_, export_dir->VirtualAddress,
+                               export_dir->Size, directory)) {
+        return nullptr;
+    }
+    
+    NameOrder order = name_order_.load();
+    UInt32 index = directory.FindName(name, strlen(name), order);
+    name_order_.store(order);
+    
+    if (index == ExportIndex::kNotFound) {
+        return nullptr;
+    }
+    
+    UInt16 function_index = directory.FunctionIndexAt(index);
+    if (function_index >= directory.number_of_functions) {
+        return nullptr;
+    }
+    
+    UInt32 rva = directory.functions[function_index];
+    if (rva == 0 || rva >= image_size_) {
+        return nullptr;
+    }
+    
+    return ResolveExportAddress(directory, rva, static_cast<char*>(code_base_) + rva);
+}
+
+// Готовый адрес экспорта: форвардер разрешается через резолвер и общий кэш
+FARPROC MemoryModule::ResolveExportAddress(const ExportDirectory& directory, UInt32 rva,
+                                           const void* address) const noexcept {
+    if (!directory.IsForwarder(rva)) {
+        return reinterpret_cast<FARPROC>(const_cast<void*>(address));
+    }
+    
+    const void* target = ResolveForwarder(directory.ForwarderAt(rva), forwarder_resolver_, forwarder_scope_);
+    return reinterpret_cast<FARPROC>(const_cast<void*>(target));
+}
+
+// Готовый адрес записи вида экспортов: форвардер и переходник счётчика
+FARPROC MemoryModule::EntryAddress(const ExportTable& table, const ExportView::Entry& entry) const noexcept {
+    return CountedAddress(entry.ordinal - table.ordinals.Base(),
+                          ResolveExportAddress(table.directory, entry.rva, entry.address));
+}
+
+// Включение счётчиков вызовов
+bool MemoryModule::EnableCallCounting() noexcept {
+    try {
+        if (!IsValid()) {
+            return false;
+        }
+        if (!call_counters_.Empty()) {
             return true;
         }
         
-        auto* export_table = reinterpret_cast<IMAGE_EXPORT_DIRECTORY*>(
-            static_cast<char*>(code_base_) + export_dir->VirtualAddress);
+        const ExportTable& table = GetExportTable();
+        size_t count = table.ordinals.Size();
+        if (count == 0) {
+            return false;
+        }
+        
+        // Оборачиваем только код: форвардеры - чужой код, а экспортированные
+        // данные должны читаться по своему адресу, а не по адресу переходника
+        std::vector<const void*> targets(count, nullptr);
+        for (UInt32 i = 0; i < count; ++i) {
+            const OrdinalEntry& entry = table.ordinals.At(i);
+            if (entry.rva != 0 && !table.IsForwarder(entry.rva) && IsExecutableRva(entry.rva)) {
+                targets[i] = entry.address;
+            }
+        }
+        
+        size_t size = CallCounters::RequiredSize(count, page_size_);
+        void* memory = VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+        if (!memory) {
+            return false;
+        }
+        
+#ifdef XMEMMOD_64BIT
+        constexpr ThunkArch kArch = ThunkArch::X64;
+#else
+        constexpr ThunkArch kArch = ThunkArch::X86;
+#endif
+        
+        // Код - только чтение и исполнение, счётчики остаются на запись
+        DWORD old_protect = 0;
+        size_t code_size = CallCounters::CodeSize(count, page_size_);
+        if (!call_counters_.Build(memory, size, page_size_, targets.data(), count, kArch) ||
+            !VirtualProtect(memory, code_size, PAGE_EXECUTE_READ, &old_protect)) {
+            call_counters_.Clear();
+            VirtualFree(memory, 0, MEM_RELEASE);
+            return false;
+        }
+        
+        FlushInstructionCache(GetCurrentProcess(), memory, code_size);
+        call_counter_memory_ = memory;
+        
+        // Запомненные ProcHandle переразрешатся в переходники
+        generation_.fetch_add(1, std::memory_order_release);
+        return true;
         
-        if (export_table->NumberOfFunctions == 0) {
-            export_list_built_.store(true);
-            return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+// Статистика вызовов по всем экспортам с переходниками
+std::vector<ExportCallStats> MemoryModule::GetCallStats() const noexcept {
+    std::vector<ExportCallStats> stats;
+    
+    try {
+        if (call_counters_.Empty()) {
+            return stats;
         }
         
-        auto* name_rva = reinterpret_cast<UInt32*>(
-            static_cast<char*>(code_base_) + export_table->AddressOfNames);
-        auto* ordinal_rva = reinterpret_cast<UInt16*>(
-            static_cast<char*>(code_base_) + export_table->AddressOfNameOrdinals);
-        auto* function_rva = reinterpret_cast<UInt32*>(
-            static_cast<char*>(code_base_) + export_table->AddressOfFunctions);
+        const ExportTable& table = GetExportTable();
+        stats.reserve(call_counters_.Size());
         
-        for (UInt32 i = 0; i < export_table->NumberOfNames; ++i) {
-            const char* name = reinterpret_cast<const char*>(
-                static_cast<char*>(code_base_) + name_rva[i]);
-            UInt16 ordinal = ordinal_rva[i];
-            void* address = static_cast<char*>(code_base_) + function_rva[ordinal];
-            
-            UInt32 func_rva = function_rva[ordinal];
-            UInt32 final_ordinal = ordinal + export_table->Base;
-            
-            ExportInfo info(final_ordinal, func_rva, export_table->Base, 
-                           static_cast<UInt32>(reinterpret_cast<uintptr_t>(address)), name, 
-                           reinterpret_cast<FARPROC>(address));
+        for (UInt32 i = 0; i < call_counters_.Size(); ++i) {
+            if (!call_counters_.ThunkAt(i)) {
+                continue;
+            }
             
-            export_list_.push_back(info);
+            const OrdinalEntry& entry = table.ordinals.At(i);
+            stats.push_back(ExportCallStats{table.ordinals.Base() + i,
+                                            std::string_view(entry.name ? entry.name : "", entry.name_length),
+                                            call_counters_.CountAt(i)});
         }
-        
-        export_list_built_.store(true);
-        return true;
-        
     } catch (...) {
-        return false;
+        stats.clear();
     }
+    
+    return stats;
+}
+
+// Число вызовов экспорта по имени
+UInt64 MemoryModule::GetCallCount(const char* name) const noexcept {
+    if (call_counters_.Empty() || !name) {
+        return 0;
+    }
+    
+    const ExportTable& table = GetExportTable();
+    UInt32 slot = table.index.Find(name);
+    return slot != ExportIndex::kNotFound ? call_counters_.CountAt(table.index.FunctionIndexAt(slot)) : 0;
+}
+
+// Сброс счётчиков
+void MemoryModule::ResetCallStats() noexcept {
+    if (!call_counters_.Empty()) {
+        call_counters_.Reset();
+    }
+}
+
+// Установка резолвера форвардеров
+void MemoryModule::SetForwarderResolver(ForwarderResolver resolver) noexcept {
+    if (forwarder_scope_ != kDefaultForwarderScope) {
+        ForwarderCache::Instance().InvalidateScope(forwarder_scope_);
+    }
+    
+    // Свой резолвер - своя область кэша
+    forwarder_resolver_ = std::move(resolver);
+    forwarder_scope_ = ForwarderCache::NewScope();
 }
 
 // Выполнение TLS
@@ -648,6 +1561,68 @@ bool MemoryModule::IsValidPE(const void* data, size_t size) const noexcept {
     return PEUtils::IsValidNTHeaders(headers);
 }
 
+// Попадает ли RVA в исполняемую секцию загруженного образа
+bool MemoryModule::IsExecutableRva(UInt32 rva) const noexcept {
+    if (!headers_) {
+        return false;
+    }
+    
+    const IMAGE_SECTION_HEADER* section = IMAGE_FIRST_SECTION(headers_.get());
+    for (UInt16 i = 0; i < headers_->FileHeader.NumberOfSections; ++i, ++section) {
+        UInt32 size = section->Misc.VirtualSize ? section->Misc.VirtualSize : section->SizeOfRawData;
+        if (rva >= section->VirtualAddress && rva - section->VirtualAddress < size) {
+            return (section->Characteristics & IMAGE_SCN_MEM_EXECUTE) != 0;
+        }
+    }
+    return false;
+}
+
+// Проверка, что секции в буфере уже лежат по своим RVA
+bool MemoryModule::IsMappedLayout(const void* data, size_t size) const noexcept {
+    if (!IsValidPE(data, size)) {
+        return false;
+    }
+    
+    const IMAGE_DOS_HEADER* dos_header = static_cast<const IMAGE_DOS_HEADER*>(data);
+    const IMAGE_NT_HEADERS* headers = reinterpret_cast<const IMAGE_NT_HEADERS*>(
+        static_cast<const char*>(data) + dos_header->e_lfanew);
+    
+    if (!IsSupportedArchitecture(headers)) {
+        return false;
+    }
+    
+    // Защита страниц задаётся по секциям - выравнивание не меньше страницы.
+    // Защищается весь образ до границы страницы: последняя страница не должна
+    // быть общей с чужими данными за концом буфера
+    const auto& optional = headers->OptionalHeader;
+    if (optional.SectionAlignment < page_size_ || AlignValue(optional.SizeOfImage, page_size_) > size ||
+        optional.SizeOfHeaders > optional.SizeOfImage) {
+        return false;
+    }
+    
+    size_t table_offset = static_cast<size_t>(dos_header->e_lfanew) + offsetof(IMAGE_NT_HEADERS, OptionalHeader) +
+                          headers->FileHeader.SizeOfOptionalHeader;
+    size_t table_size = static_cast<size_t>(headers->FileHeader.NumberOfSections) * sizeof(IMAGE_SECTION_HEADER);
+    if (table_offset + table_size > optional.SizeOfHeaders) {
+        return false;
+    }
+    
+    const IMAGE_SECTION_HEADER* section = IMAGE_FIRST_SECTION(headers);
+    for (UInt16 i = 0; i < headers->FileHeader.NumberOfSections; ++i, ++section) {
+        if (section->SizeOfRawData != 0 && section->PointerToRawData != section->VirtualAddress) {
+            return false;
+        }
+        
+        UInt64 extent = std::max(section->Misc.VirtualSize, section->SizeOfRawData);
+        if (section->VirtualAddress % page_size_ != 0 ||
+            static_cast<UInt64>(section->VirtualAddress) + extent > optional.SizeOfImage) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
 // Проверка поддерживаемой архитектуры
 bool MemoryModule::IsSupportedArchitecture(const IMAGE_NT_HEADERS* headers) const noexcept {
 #ifdef _WIN64
@@ -682,6 +1657,15 @@ bool MemoryModule::SetSectionProtection(void* address, size_t size, DWORD charac
             protect = PAGE_READONLY;
         }
         
+        // В отображении файла запись возможна только с копированием
+        if (storage_ == ImageStorage::FileView) {
+            if (protect == PAGE_READWRITE) {
+                protect = PAGE_WRITECOPY;
+            } else if (protect == PAGE_EXECUTE_READWRITE) {
+                protect = PAGE_EXECUTE_WRITECOPY;
+            }
+        }
+        
         DWORD old_protect;
         return VirtualProtect(address, size, protect, &old_protect) != 0;
         
@@ -691,11 +1675,336 @@ bool MemoryModule::SetSectionProtection(void* address, size_t size, DWORD charac
 }
 
 // Создание информации об экспорте
-ExportInfo MemoryModule::CreateExportInfo(UInt32 ordinal, UInt32 rva, UInt16 ord_base, 
+ExportInfo MemoryModule::CreateExportInfo(UInt32 ordinal, UInt32 rva, UInt32 ord_base, 
                                         UInt32 va, const std::string& name, FARPROC address) const noexcept {
     return ExportInfo(ordinal, rva, ord_base, va, name, address);
 }
 
+// Реализация MemoryModuleSet
+MemoryModuleSet::MemoryModuleSet(SymbolPrecedence precedence) noexcept
+    : symbols_(precedence) {}
+
+// Добавление модуля по ссылке
+bool MemoryModuleSet::Add(MemoryModule& module, int priority) noexcept {
+    return AddModule(&module, nullptr, priority);
+}
+
+// Добавление модуля во владение набора
+MemoryModule* MemoryModuleSet::Add(std::unique_ptr<MemoryModule> module, int priority) noexcept {
+    MemoryModule* raw = module.get();
+    return AddModule(raw, std::move(module), priority) ? raw : nullptr;
+}
+
+// Общая часть добавления
+bool MemoryModuleSet::AddModule(MemoryModule* module, std::unique_ptr<MemoryModule> owned, int priority) noexcept {
+    try {
+        if (!module || !module->IsValid()) {
+            return false;
+        }
+        
+        // Таблица экспортов строится до захвата блокировки набора
+        const ExportTable& table = module->GetExportTable();
+        
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        
+        if (modules_.count(module) != 0) {
+            return false;
+        }
+        
+        auto it = modules_.emplace(module, std::move(owned)).first;
+        if (!symbols_.Add(module, priority, table.view)) {
+            modules_.erase(it);
+            return false;
+        }
+        
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Удаление модуля
+bool MemoryModuleSet::Remove(const MemoryModule* module) noexcept {
+    std::unique_ptr<MemoryModule> owned;
+    
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        
+        auto it = modules_.find(module);
+        if (it == modules_.end()) {
+            return false;
+        }
+        
+        symbols_.Remove(module, module->GetExportTable().view);
+        owned = std::move(it->second);
+        modules_.erase(it);
+    }
+    
+    // Выгрузка принадлежащего модуля - уже без блокировки
+    return true;
+}
+
+// Смена правила выбора поставщика
+void MemoryModuleSet::SetPrecedence(SymbolPrecedence precedence) noexcept {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    symbols_.SetPrecedence(precedence);
+}
+
+// Результат по поставщику под блокировкой набора: модуль жив, пока он в наборе.
+// Для форвардера копируется текст и резолвер - сам модуль после снятия
+// блокировки может быть удалён и выгружен
+void MemoryModuleSet::PrepareSymbol(const SymbolNamespace::Provider& provider, PendingSymbol& pending) const {
+    auto* module = static_cast<MemoryModule*>(const_cast<void*>(provider.owner));
+    const ExportTable& table = module->GetExportTable();
+    UInt32 rva = table.RvaAt(provider.position);
+    
+    pending.symbol = Symbol{module, table.OrdinalAt(provider.position), nullptr};
+    if (table.directory.IsForwarder(rva)) {
+        pending.forwarder.assign(table.directory.ForwarderAt(rva));
+        pending.resolver = module->forwarder_resolver_;
+        pending.scope = module->forwarder_scope_;
+        return;
+    }
+    
+    // Форвардеры переходниками не оборачиваются, прямой адрес - сразу
+    pending.symbol.address = module->CountedAddress(table.index.FunctionIndexAt(provider.position),
+                                                    reinterpret_cast<FARPROC>(const_cast<void*>(table.AddressAt(provider.position))));
+}
+
+// Разрешение форвардера без блокировки набора: резолвер может сам добавлять,
+// удалять или искать модули этого набора
+MemoryModuleSet::Symbol MemoryModuleSet::FinishSymbol(PendingSymbol& pending) const noexcept {
+    if (!pending.forwarder.empty()) {
+        const void* target = ResolveForwarder(pending.forwarder, pending.resolver, pending.scope);
+        pending.symbol.address = reinterpret_cast<FARPROC>(const_cast<void*>(target));
+    }
+    return pending.symbol;
+}
+
+// Поиск по имени
+FARPROC MemoryModuleSet::GetProcAddress(const char* name) const noexcept {
+    if (!name) {
+        return nullptr;
+    }
+    
+    size_t length = strlen(name);
+    SymbolKey key(name, 0);
+    key.length = static_cast<UInt32>(length);
+    key.hash = SymbolHash::HashFast(name, length);
+    return GetProcAddress(key);
+}
+
+// Поиск по заранее посчитанному ключу
+FARPROC MemoryModuleSet::GetProcAddress(const SymbolKey& key) const noexcept {
+    Symbol symbol;
+    return FindSymbol(key, symbol) ? symbol.address : nullptr;
+}
+
+// Поиск поставщика имени
+bool MemoryModuleSet::FindSymbol(const SymbolKey& key, Symbol& symbol) const noexcept {
+    try {
+        PendingSymbol pending;
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            
+            const SymbolNamespace::Provider* found = symbols_.Find(key);
+            if (!found) {
+                return false;
+            }
+            PrepareSymbol(*found, pending);
+        }
+        
+        symbol = FinishSymbol(pending);
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Все поставщики имени
+std::vector<MemoryModuleSet::Symbol> MemoryModuleSet::FindAllSymbols(const SymbolKey& key) const noexcept {
+    std::vector<Symbol> result;
+    
+    try {
+        std::vector<PendingSymbol> pending;
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            
+            size_t count = 0;
+            const SymbolNamespace::Provider* found = symbols_.FindAll(key, count);
+            pending.resize(count);
+            for (size_t i = 0; i < count; ++i) {
+                PrepareSymbol(found[i], pending[i]);
+            }
+        }
+        
+        result.reserve(pending.size());
+        for (auto& entry : pending) {
+            result.push_back(FinishSymbol(entry));
+        }
+    } catch (...) {
+        result.clear();
+    }
+    
+    return result;
+}
+
+// Количество модулей
+size_t MemoryModuleSet::GetModuleCount() const noexcept {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return modules_.size();
+}
+
+// Количество различных имён
+size_t MemoryModuleSet::GetSymbolCount() const noexcept {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return symbols_.Size();
+}
+
+// Реализация ReloadableModule
+ReloadableModule::ReadGuard::ReadGuard(const ReloadableModule& owner) noexcept {
+    // Полоса по адресу стека (потоки не делят стек), как у счётчиков вызовов
+    size_t stripe = (reinterpret_cast<uintptr_t>(this) >> 20) & (kStripes - 1);
+    
+    // Повтор, если эпоха сменилась между чтением и регистрацией: иначе
+    // Synchronize мог уже проверить этот счётчик и не дождаться нас
+    for (;;) {
+        UInt64 epoch = owner.epoch_.load(std::memory_order_seq_cst);
+        std::atomic<UInt64>* counter = &owner.readers_[epoch & 1][stripe].value;
+        counter->fetch_add(1, std::memory_order_seq_cst);
+        
+        if (owner.epoch_.load(std::memory_order_seq_cst) == epoch) {
+            counter_ = counter;
+            return;
+        }
+        counter->fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
+
+ReloadableModule::ReadGuard::~ReadGuard() noexcept {
+    counter_->fetch_sub(1, std::memory_order_release);
+}
+
+ReloadableModule::ReloadableModule() noexcept
+    : epoch_(0)
+    , current_(nullptr)
+    , version_(0) {}
+
+ReloadableModule::~ReloadableModule() noexcept {
+    Unload();
+}
+
+// Смена эпохи: новые читатели попадают в другую чётность, прежних дожидаемся
+void ReloadableModule::Synchronize() noexcept {
+    UInt64 epoch = epoch_.fetch_add(1, std::memory_order_seq_cst);
+    ReaderCount* counts = readers_[epoch & 1];
+    
+    for (;;) {
+        UInt64 active = 0;
+        for (size_t i = 0; i < kStripes; ++i) {
+            active += counts[i].value.load(std::memory_order_seq_cst);
+        }
+        if (active == 0) {
+            break;
+        }
+        std::this_thread::yield();
+    }
+}
+
+// Загрузка новой версии рядом со старой и атомарная подмена
+bool ReloadableModule::Reload(const void* data, size_t size) noexcept {
+    try {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        auto module = std::make_unique<MemoryModule>();
+        if (!module->LoadFromMemory(data, size)) {
+            return false;
+        }
+        
+        // Индекс строится до публикации - читатели его не ждут
+        module->GetExportView();
+        
+        std::vector<FARPROC> addresses(slots_.size(), nullptr);
+        for (const auto& slot : slot_index_) {
+            addresses[slot.second] = module->GetProcAddress(slot.first.c_str());
+            if (!addresses[slot.second]) {
+                return false;
+            }
+        }
+        
+        // Публикация: каждая ячейка атомарна, новая версия уже готова целиком
+        for (size_t i = 0; i < addresses.size(); ++i) {
+            slots_[i].store(addresses[i], std::memory_order_release);
+        }
+        current_.store(module.get(), std::memory_order_release);
+        version_.fetch_add(1, std::memory_order_acq_rel);
+        
+        std::unique_ptr<MemoryModule> retired = std::move(module_);
+        module_ = std::move(module);
+        
+        // Старый код остаётся отображённым до выхода всех его читателей
+        if (retired) {
+            Synchronize();
+        }
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Выгрузка текущей версии; ячейки обнуляются, но остаются действительными
+bool ReloadableModule::Unload() noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!module_) {
+        return false;
+    }
+    
+    for (auto& slot : slots_) {
+        slot.store(nullptr, std::memory_order_release);
+    }
+    current_.store(nullptr, std::memory_order_release);
+    
+    Synchronize();
+    module_.reset();
+    return true;
+}
+
+// Ячейка для имени: выдаётся один раз и далее обновляется при Reload
+const ReloadableModule::Slot* ReloadableModule::GetSlot(const char* name) noexcept {
+    try {
+        if (!name) {
+            return nullptr;
+        }
+        
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        auto it = slot_index_.find(name);
+        if (it != slot_index_.end()) {
+            return &slots_[it->second];
+        }
+        
+        if (!module_) {
+            return nullptr;
+        }
+        
+        FARPROC address = module_->GetProcAddress(name);
+        if (!address) {
+            return nullptr;
+        }
+        
+        slots_.emplace_back(address);
+        slot_index_.emplace(name, slots_.size() - 1);
+        return &slots_.back();
+        
+    } catch (...) {
+        return nullptr;
+    }
+}
+
 // Реализация PEUtils
 namespace PEUtils {
     bool IsValidDOSHeader(const IMAGE_DOS_HEADER* header) noexcept {
@@ -747,7 +2056,7 @@ namespace Utils {
         return oss.str();
     }
     
-    std::string FormatOrdinal(UInt16 ordinal) noexcept {
+    std::string FormatOrdinal(UInt32 ordinal) noexcept {
         std::ostringstream oss;
         oss << "0x" << std::hex << std::uppercase << ordinal;
         return oss.str();
@@ -801,11 +2110,36 @@ extern "C" {
         return module->LoadFromMemory(data, size);
     }
     
+    bool memory_module_load_from_file(MemoryModule::MemoryModule* module, const char* path) noexcept {
+        if (!module) return false;
+        return module->LoadFromFile(path);
+    }
+    
+    bool memory_module_load_from_mapped_layout(MemoryModule::MemoryModule* module, void* image, size_t size,
+                                               int adopt) noexcept {
+        if (!module) return false;
+        return module->LoadFromMappedLayout(image, size,
+                                            adopt ? MemoryModule::Ownership::Adopt : MemoryModule::Ownership::Borrow);
+    }
+    
+    bool memory_module_load_from_owned_buffer(MemoryModule::MemoryModule* module, void* buffer, size_t size,
+                                              size_t capacity, int adopt) noexcept {
+        if (!module) return false;
+        return module->LoadFromOwnedBuffer(buffer, size, capacity,
+                                           adopt ? MemoryModule::Ownership::Adopt : MemoryModule::Ownership::Borrow);
+    }
+    
     FARPROC memory_module_get_proc_address(MemoryModule::MemoryModule* module, const char* name) noexcept {
         if (!module) return nullptr;
         return module->GetProcAddress(name);
     }
     
+    size_t memory_module_resolve_many(MemoryModule::MemoryModule* module, const char* const* names, 
+                                      FARPROC* out, size_t count) noexcept {
+        if (!module) return 0;
+        return module->ResolveMany(names, out, count);
+    }
+    
     bool memory_module_unload(MemoryModule::MemoryModule* module) noexcept {
         if (!module) return false;
         return module->Unload();
@@ -824,36 +2158,109 @@ extern "C" {
     void memory_module_get_export_list(MemoryModule::MemoryModule* module, 
                                       MemoryModule::ExportInfo* exports, 
                                       size_t* count) noexcept {
-        if (!module || !exports || !count) {
+        if (!count) return;
+        if (!module) {
             *count = 0;
             return;
         }
         
+        // *count на входе - ёмкость exports; копируется не больше неё
+        size_t capacity = exports ? *count : 0;
         auto export_list = module->GetExportList();
-        *count = export_list.size();
         
-        for (size_t i = 0; i < export_list.size() && i < *count; ++i) {
+        for (size_t i = 0; i < export_list.size() && i < capacity; ++i) {
             exports[i] = export_list[i];
         }
+        *count = export_list.size();
     }
     
     FARPROC memory_module_get_proc_address_by_ordinal(MemoryModule::MemoryModule* module, 
-                                                     MemoryModule::UInt16 ordinal) noexcept {
+                                                     MemoryModule::UInt32 ordinal) noexcept {
         if (!module) return nullptr;
         return module->GetProcAddressByOrdinal(ordinal);
     }
     
     const char* memory_module_get_function_name(MemoryModule::MemoryModule* module, 
-                                               MemoryModule::UInt16 ordinal) noexcept {
+                                               MemoryModule::UInt32 ordinal) noexcept {
         if (!module) return nullptr;
         static thread_local std::string result;
         result = module->GetFunctionName(ordinal);
         return result.c_str();
     }
     
-    MemoryModule::UInt16 memory_module_get_function_ordinal(MemoryModule::MemoryModule* module, 
+    MemoryModule::UInt32 memory_module_get_function_ordinal(MemoryModule::MemoryModule* module, 
                                              const char* name) noexcept {
         if (!module) return 0;
         return module->GetFunctionOrdinal(name);
     }
+    
+    size_t memory_module_enumerate_exports(MemoryModule::MemoryModule* module, const char* pattern,
+                                           memory_module_export_callback callback, void* context) noexcept {
+        if (!module || !callback) return 0;
+        try {
+            return module->EnumerateExports(pattern ? pattern : "",
+                [callback, context](const MemoryModule::ExportView::Entry& entry, FARPROC address) {
+                    return callback(entry.name.data(), entry.name.size(), entry.ordinal, address, context);
+                });
+        } catch (...) {
+            return 0;
+        }
+    }
+    
+    bool memory_module_enable_call_counting(MemoryModule::MemoryModule* module) noexcept {
+        if (!module) return false;
+        return module->EnableCallCounting();
+    }
+    
+    MemoryModule::UInt64 memory_module_get_call_count(MemoryModule::MemoryModule* module, const char* name) noexcept {
+        if (!module) return 0;
+        return module->GetCallCount(name);
+    }
+    
+    size_t memory_module_get_call_stats(MemoryModule::MemoryModule* module, memory_module_call_stats* stats,
+                                        size_t capacity) noexcept {
+        if (!module) return 0;
+        
+        auto all = module->GetCallStats();
+        size_t count = all.size() < capacity ? all.size() : capacity;
+        for (size_t i = 0; stats && i < count; ++i) {
+            stats[i].ordinal = all[i].ordinal;
+            stats[i].name = all[i].name.data();
+            stats[i].name_length = all[i].name.size();
+            stats[i].calls = all[i].calls;
+        }
+        return all.size();
+    }
+    
+    void memory_module_reset_call_stats(MemoryModule::MemoryModule* module) noexcept {
+        if (module) module->ResetCallStats();
+    }
+    
+    MemoryModule::MemoryModuleSet* memory_module_set_create() noexcept {
+        try {
+            return new MemoryModule::MemoryModuleSet();
+        } catch (...) {
+            return nullptr;
+        }
+    }
+    
+    void memory_module_set_destroy(MemoryModule::MemoryModuleSet* set) noexcept {
+        delete set;
+    }
+    
+    bool memory_module_set_add(MemoryModule::MemoryModuleSet* set, MemoryModule::MemoryModule* module,
+                               int priority) noexcept {
+        if (!set || !module) return false;
+        return set->Add(*module, priority);
+    }
+    
+    bool memory_module_set_remove(MemoryModule::MemoryModuleSet* set, MemoryModule::MemoryModule* module) noexcept {
+        if (!set) return false;
+        return set->Remove(module);
+    }
+    
+    FARPROC memory_module_set_get_proc_address(MemoryModule::MemoryModuleSet* set, const char* name) noexcept {
+        if (!set) return nullptr;
+        return set->GetProcAddress(name);
+    }
 }
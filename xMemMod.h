@@ -54,42 +54,73 @@
 #include <cstddef>
 #include <string>
 #include <vector>
+#include <array>
 #include <memory>
 #include <atomic>
 #include <mutex>
+#include <deque>
+#include <type_traits>
+#include <shared_mutex>
+#include <unordered_map>
 
 // Windows-specific includes
 #include <windows.h>
 #include <winnt.h>
 
+// Platform-independent parts
+#include "xMemModTypes.h"
+#include "xMemModExports.h"
+#include "xMemModIndexFile.h"
+#include "xMemModThunks.h"
+#include "xMemModCopy.h"
+#include "xMemModReloc.h"
+
 namespace MemoryModule {
 
 // Forward declarations
 class MemoryModule;
-
-// Portable integer types
-using UInt8 = std::uint8_t;
-using UInt16 = std::uint16_t;
-using UInt32 = std::uint32_t;
-using UInt64 = std::uint64_t;
+class MemoryModuleSet;
+class ReloadableModule;
+class ProcHandle;
 
 // Расширенная структура ExportInfo с готовыми указателями
 struct ExportInfo {
     UInt32 ordinal;        // Порядковый номер
     UInt32 rva;           // RVA (Relative Virtual Address)
-    UInt16 ordinal_base;  // База ординалов
+    UInt32 ordinal_base;  // База ординалов
     UInt32 va;            // Virtual Address
-    std::string name;     // Имя функции
+    std::string name;     // Имя функции (пустое для экспорта только по ординалу)
     FARPROC address;      // ГОТОВЫЙ к использованию указатель на функцию
     
     ExportInfo() : ordinal(0), rva(0), ordinal_base(0), va(0), address(nullptr) {}
     
-    ExportInfo(UInt32 ord, UInt32 func_rva, UInt16 ord_base, UInt32 virtual_addr, 
+    ExportInfo(UInt32 ord, UInt32 func_rva, UInt32 ord_base, UInt32 virtual_addr, 
                const std::string& func_name, FARPROC func_address)
         : ordinal(ord), rva(func_rva), ordinal_base(ord_base), va(virtual_addr), 
           name(func_name), address(func_address) {}
 };
 
+// Владение буфером образа в LoadFromMappedLayout
+enum class Ownership {
+    Borrow,   // Буфер остаётся у вызывающего и должен пережить модуль
+    Adopt     // Буфер из VirtualAlloc переходит модулю (освобождается и при ошибке);
+              // невыровненный на страницу буфер отклоняется и остаётся у вызывающего
+};
+
+// Буфер под образ для LoadFromOwnedBuffer: память VirtualAlloc (выровнена на
+// страницу), освобождается VirtualFree. Выделяется MemoryModule::AllocateImageBuffer.
+struct ImageBufferDeleter {
+    void operator()(std::byte* buffer) const noexcept;
+};
+using ImageBuffer = std::unique_ptr<std::byte[], ImageBufferDeleter>;
+
+// Статистика вызовов экспорта (EnableCallCounting)
+struct ExportCallStats {
+    UInt32 ordinal;         // Ординал экспорта
+    std::string_view name;  // Имя в образе (пустое для экспорта только по ординалу)
+    UInt64 calls;           // Число вызовов через выданные указатели
+};
+
 // Основной класс MemoryModule
 class MemoryModule {
 public:
@@ -105,14 +136,79 @@ public:
     
     // Основные методы
     bool LoadFromMemory(const void* data, size_t size) noexcept;
+    
+    // Загрузка из файла через его отображение. Если секции в файле уже лежат
+    // по своим RVA (FileAlignment == SectionAlignment), образ не копируется:
+    // страницы отображаются с копированием при записи и остаются общими с
+    // файловым кэшем, пока их не изменят релокации или запись. Иначе секции
+    // копируются прямо из отображения, без промежуточного буфера.
+    // Дескриптор для LoadFromHandle - с GENERIC_READ (и GENERIC_EXECUTE для
+    // загрузки без копирования); после возврата его можно закрыть.
+    bool LoadFromFile(const char* path) noexcept;
+    bool LoadFromHandle(HANDLE file) noexcept;
+    
+    // Загрузка образа, уже разложенного по RVA (снятый с процесса модуль с
+    // исправленными заголовками, файл с FileAlignment == SectionAlignment).
+    // Секции должны лежать по своим RVA (PointerToRawData == VirtualAddress),
+    // буфер - начинаться с границы страницы и вмещать SizeOfImage, выровненный
+    // на страницу (защита ставится постранично). Секции не копируются: релокации
+    // применяются на месте. После Unload заимствованный буфер снова доступен
+    // на чтение и запись.
+    bool LoadFromMappedLayout(void* image, size_t size, Ownership ownership) noexcept;
+    
+    // Загрузка из буфера с файлом (size байт) ёмкостью capacity >= SizeOfImage,
+    // выровненного на страницу: секции переносятся на свои RVA на месте (от
+    // последней к первой), промежутки обнуляются, и буфер становится образом.
+    // Ни второго выделения, ни полного копирования - пиковая память вдвое меньше.
+    // ImageBuffer принадлежит модулю; void* - по правилам Ownership. Невыровненный
+    // заимствованный буфер не портится: образ загружается копированием, как в
+    // LoadFromMemory; невыровненный Adopt отклоняется без освобождения.
+    // Если проверка заголовков прошла, а загрузка нет - содержимое буфера испорчено.
+    bool LoadFromOwnedBuffer(ImageBuffer buffer, size_t size, size_t capacity) noexcept;
+    bool LoadFromOwnedBuffer(void* buffer, size_t size, size_t capacity, Ownership ownership) noexcept;
+    // Выделение буфера для LoadFromOwnedBuffer (nullptr при ошибке)
+    static ImageBuffer AllocateImageBuffer(size_t capacity) noexcept;
     FARPROC GetProcAddress(const char* name) const noexcept;
+    FARPROC GetProcAddress(const SymbolKey& key) const noexcept;
+    
+    // Пакетное разрешение имён: out[i] = адрес или nullptr для отсутствующего имени.
+    // Возвращает количество найденных имён.
+    size_t ResolveMany(const char* const* names, FARPROC* out, size_t count) const noexcept;
+    size_t ResolveMany(const SymbolKey* keys, FARPROC* out, size_t count) const noexcept;
+    
+    // Привязка интерфейса за один пакетный проход по индексу. Api перечисляет
+    // функции в static constexpr auto Bindings() через BindRequired/BindOptional;
+    // в результате - заполненная таблица и сразу все отсутствующие обязательные имена.
+    template <typename Api>
+    BindResult<Api> BindTable() const noexcept {
+        BindResult<Api> result;
+        try {
+            static constexpr auto keys = BindingKeys<Api>();
+            std::array<FARPROC, keys.size()> addresses{};
+            
+            ResolveMany(keys.data(), addresses.data(), keys.size());
+            ApplyBindings(result.api, addresses.data(), result.missing);
+            result.ok = result.missing.empty();
+        } catch (...) {
+            result.ok = false;
+        }
+        return result;
+    }
     std::vector<ExportInfo> GetExportList() const noexcept;
     bool Unload() noexcept;
     bool Is64Bit() const noexcept;
     
+    // Представление экспортов без копирования (действительно до Unload)
+    const ExportView& GetExportView() const noexcept;
+    
     // Дополнительные методы
     bool IsValid() const noexcept { return code_base_ != nullptr; }
     bool IsLoaded() const noexcept { return is_loaded_.load(); }
+    bool IsFileBacked() const noexcept { return storage_ == ImageStorage::FileView; }
+    
+    // Поколение загрузки: растёт при LoadFromMemory, Unload и EnableCallCounting,
+    // т.е. при любой смене выдаваемых адресов (используется ProcHandle)
+    UInt64 GetGeneration() const noexcept { return generation_.load(std::memory_order_relaxed); }
     const void* GetBaseAddress() const noexcept { return code_base_; }
     size_t GetImageSize() const noexcept { return image_size_; }
     
@@ -120,40 +216,154 @@ public:
     std::string GetModuleName() const noexcept;
     UInt32 GetExportCount() const noexcept;
     
-    // Поиск функций по различным критериям
-    FARPROC GetProcAddressByOrdinal(UInt16 ordinal) const noexcept;
-    std::string GetFunctionName(UInt16 ordinal) const noexcept;
-    UInt16 GetFunctionOrdinal(const char* name) const noexcept;
+    // Поиск функций по различным критериям (ординал - полный, с учётом Base)
+    FARPROC GetProcAddressByOrdinal(UInt32 ordinal) const noexcept;
+    // По идентификатору из SymbolPool (хеш и длина берутся из пула)
+    FARPROC GetProcAddressById(SymbolId id) const noexcept;
+    std::string GetFunctionName(UInt32 ordinal) const noexcept;
+    UInt32 GetFunctionOrdinal(const char* name) const noexcept;
+    
+    // Обратный поиск: ближайший предшествующий экспорт, смещение и оценка
+    // размера (для профилировщиков и обработчиков падений)
+    bool FindExportByAddress(const void* address, ExportSymbol& symbol) const noexcept;
+    
+    // Сохраняемый индекс экспортов, общий для процессов. Ключ содержимого
+    // годится как имя файла в кэше; AttachExportIndex отображает файл и
+    // использует его для поиска по имени вместо построения индекса. Устаревший
+    // или повреждённый файл отклоняется (false) - тогда индекс строится как обычно.
+    // Подключается сразу после загрузки, до поиска из других потоков.
+    UInt64 GetExportIndexKey() const noexcept;
+    bool SaveExportIndex(const char* path) const noexcept;
+    bool AttachExportIndex(const char* path) noexcept;
+    
+    // Счётчики вызовов экспортов. По умолчанию выключены и ничего не стоят.
+    // После EnableCallCounting() GetProcAddress, ResolveMany, BindTable,
+    // GetExportList и MemoryModuleSet выдают адреса переходников, которые
+    // считают вызовы и переходят на функцию (GetExportView - исходные адреса).
+    // Оборачиваются только RVA в исполняемых секциях; данные и форвардеры - как есть.
+    // Включается до раздачи указателей, не одновременно с поиском.
+    bool EnableCallCounting() noexcept;
+    bool IsCallCountingEnabled() const noexcept { return !call_counters_.Empty(); }
+    std::vector<ExportCallStats> GetCallStats() const noexcept;
+    UInt64 GetCallCount(const char* name) const noexcept;
+    void ResetCallStats() noexcept;
+    
+    // Копирование секций при загрузке: пороги параллельного и потокового
+    // копирования, размер куска и число потоков. Задаётся до LoadFromMemory.
+    void SetCopyOptions(const CopyOptions& options) noexcept { copy_options_ = options; }
+    const CopyOptions& GetCopyOptions() const noexcept { return copy_options_; }
+    
+    // Применение релокаций: с какого числа блоков (страниц) включаются потоки
+    // и сколько их. Задаётся до загрузки.
+    void SetRelocationOptions(const RelocationOptions& options) noexcept { relocation_options_ = options; }
+    const RelocationOptions& GetRelocationOptions() const noexcept { return relocation_options_; }
+    
+    // Резолвер форвардеров ("OTHER.Func"); по умолчанию - LoadLibraryA + ::GetProcAddress.
+    // Результаты запоминаются в общем на процесс ForwarderCache, но в своей области
+    // для каждого подключённого резолвера; смена резолвера сбрасывает прежние
+    // результаты этого модуля. Задаётся до поиска.
+    void SetForwarderResolver(ForwarderResolver resolver) noexcept;
+    
+    // Перечисление экспортов по префиксу ("Plugin_") или шаблону ("Codec_*_Create").
+    // callback(const ExportView::Entry&) получает сырые данные вида (у форвардера
+    // entry.address указывает на строку "OTHER.Func"); callback(entry, FARPROC) -
+    // ещё и готовый адрес, как у GetProcAddress: форвардер разрешён (nullptr, если
+    // не удалось), при включённых счётчиках - переходник. callback может вернуть
+    // false для остановки. Возвращает число совпадений; имена не копируются.
+    template <typename Callback>
+    size_t EnumerateExports(std::string_view pattern, Callback&& callback) const {
+        const ExportTable& table = GetExportTable();
+        if constexpr (std::is_invocable_v<Callback&, const ExportView::Entry&, FARPROC>) {
+            return table.names.ForEachMatch(pattern, table.view, [&](const ExportView::Entry& entry) {
+                FARPROC address = EntryAddress(table, entry);
+                if constexpr (std::is_void_v<std::invoke_result_t<Callback&, const ExportView::Entry&, FARPROC>>) {
+                    callback(entry, address);
+                    return true;
+                } else {
+                    return static_cast<bool>(callback(entry, address));
+                }
+            });
+        } else {
+            return table.names.ForEachMatch(pattern, table.view, std::forward<Callback>(callback));
+        }
+    }
+    
+#ifdef XMEMMOD_HAS_SYMBOL_NAME_TEMPLATES
+    // Поиск с хешем, посчитанным при компиляции: module.GetProc<"Init">()
+    template <SymbolName Name>
+    FARPROC GetProc() const noexcept {
+        static constexpr SymbolKey key = Name.Key();
+        return GetProcAddress(key);
+    }
+#endif
     
 private:
+    friend class MemoryModuleSet;
+    
+    // Происхождение памяти образа (определяет способ освобождения)
+    enum class ImageStorage : UInt8 {
+        Allocated,   // VirtualAlloc (свой или принятый буфер)
+        FileView,    // Отображение файла с копированием при записи
+        Borrowed     // Буфер вызывающего, не освобождается
+    };
+    
     // Основные данные
     void* code_base_;
     size_t image_size_;
     std::unique_ptr<IMAGE_NT_HEADERS, void(*)(IMAGE_NT_HEADERS*)> headers_;
     std::atomic<bool> is_loaded_;
     std::atomic<bool> is_64bit_;
+    std::atomic<UInt64> generation_;
+    ImageStorage storage_;
     
-    // Кэшированные данные экспорта
-    mutable std::vector<ExportInfo> export_list_;
+    // Кэшированные данные экспорта: неизменяемая таблица публикуется один раз
+    // (release) и далее читается без блокировок (acquire); мьютекс нужен
+    // только для однократного построения. Указатель владеющий.
+    mutable std::atomic<const ExportTable*> export_table_;
     mutable std::mutex export_mutex_;
-    mutable std::atomic<bool> export_list_built_;
+    mutable std::atomic<NameOrder> name_order_;
+    
+    // Разрешение форвардеров
+    ForwarderResolver forwarder_resolver_;
+    ForwarderScope forwarder_scope_;
+    
+    // Отображённый файл индекса экспортов (AttachExportIndex)
+    MappedExportIndex mapped_index_;
+    const void* mapped_index_view_;
+    
+    // Переходники со счётчиками вызовов (EnableCallCounting)
+    CallCounters call_counters_;
+    void* call_counter_memory_;
+    
+    // Настройки копирования секций и применения релокаций
+    CopyOptions copy_options_;
+    RelocationOptions relocation_options_;
     
     // Системная информация
     UInt32 page_size_;
     
     // Внутренние методы
     bool LoadPE(const void* data, size_t size) noexcept;
+    bool LoadPEInPlace(void* image, size_t size, ImageStorage storage) noexcept;
+    bool LinkImage(UInt64 original_base) noexcept;
+    bool LoadExpanded(void* buffer, size_t size, size_t capacity, ImageStorage storage) noexcept;
+    bool ExpandInPlace(void* buffer, size_t size, size_t capacity) const noexcept;
     bool CopySections(const void* data, const IMAGE_NT_HEADERS* old_headers) noexcept;
     bool FinalizeSections() noexcept;
     bool PerformBaseRelocation(std::ptrdiff_t delta) noexcept;
     bool BuildImportTable() noexcept;
     bool BuildExportTable() const noexcept;
+    bool ReadExportDirectory(ExportDirectory& directory, ImageFingerprint& fingerprint) const noexcept;
+    void DetachExportIndex() noexcept;
+    const ExportTable& GetExportTable() const noexcept;
     bool ExecuteTLS() noexcept;
     bool CallEntryPoint() noexcept;
     
     // Утилиты
     bool IsValidPE(const void* data, size_t size) const noexcept;
+    bool IsMappedLayout(const void* data, size_t size) const noexcept;
     bool IsSupportedArchitecture(const IMAGE_NT_HEADERS* headers) const noexcept;
+    bool IsExecutableRva(UInt32 rva) const noexcept;
     void* AlignAddress(void* address, size_t alignment) const noexcept;
     size_t AlignValue(size_t value, size_t alignment) const noexcept;
     
@@ -169,10 +379,204 @@ private:
     
     // Обработка экспортов
     bool ParseExportDirectory() const noexcept;
-    ExportInfo CreateExportInfo(UInt32 ordinal, UInt32 rva, UInt16 ord_base, 
+    FARPROC FindProcWithoutIndex(const char* name) const noexcept;
+    FARPROC ResolveExportAddress(const ExportDirectory& directory, UInt32 rva, const void* address) const noexcept;
+    FARPROC EntryAddress(const ExportTable& table, const ExportView::Entry& entry) const noexcept;
+    
+    // Адрес для выдачи наружу: переходник со счётчиком, если счётчики включены
+    FARPROC CountedAddress(UInt32 function_index, FARPROC address) const noexcept {
+        if (call_counters_.Empty()) {
+            return address;
+        }
+        const void* thunk = call_counters_.ThunkAt(function_index);
+        return thunk ? reinterpret_cast<FARPROC>(const_cast<void*>(thunk)) : address;
+    }
+    ExportInfo CreateExportInfo(UInt32 ordinal, UInt32 rva, UInt32 ord_base, 
                               UInt32 va, const std::string& name, FARPROC address) const noexcept;
 };
 
+// Запомненный адрес экспорта для горячих циклов: адрес плюс поколение модуля.
+// get() - одно relaxed-чтение поколения и сравнение; повторный поиск только
+// после перезагрузки или выгрузки (тогда get() вернёт nullptr).
+// Имя в ключе должно жить дольше дескриптора (обычно литерал). Дескриптор
+// не синхронизирован: у каждого потока своя копия (копирование дешёвое).
+class ProcHandle {
+public:
+    ProcHandle() noexcept
+        : module_(nullptr)
+        , key_(nullptr, 0)
+        , address_(nullptr)
+        , generation_(0) {}
+    
+    ProcHandle(const MemoryModule& module, const SymbolKey& key) noexcept
+        : module_(&module)
+        , key_(key)
+        , address_(nullptr)
+        , generation_(0) {}
+    
+    ProcHandle(const MemoryModule& module, const char* name) noexcept
+        : ProcHandle(module, SymbolKey(name)) {}
+    
+    FARPROC get() const noexcept {
+        if (!module_) {
+            return nullptr;
+        }
+        UInt64 generation = module_->GetGeneration();
+        return generation == generation_ ? address_ : Refresh(generation);
+    }
+    
+    // Типизированный адрес: handle.As<int(*)(int)>()
+    template <typename Function>
+    Function As() const noexcept {
+        return reinterpret_cast<Function>(get());
+    }
+    
+    explicit operator bool() const noexcept { return get() != nullptr; }
+    
+private:
+    FARPROC Refresh(UInt64 generation) const noexcept {
+        address_ = module_->GetProcAddress(key_);
+        generation_ = generation;
+        return address_;
+    }
+    
+    const MemoryModule* module_;
+    SymbolKey key_;
+    mutable FARPROC address_;
+    mutable UInt64 generation_;   // 0 - ещё не разрешён (поколение модуля >= 1)
+};
+
+// Набор модулей с общим пространством имён экспортов: "какой модуль
+// предоставляет X" - одна проба объединённого индекса вместо опроса каждого
+// модуля. Добавление и удаление модуля обновляют индекс только его именами.
+// Поиск идёт под разделяемой блокировкой и масштабируется по потокам.
+class MemoryModuleSet {
+public:
+    // Результат поиска по набору
+    struct Symbol {
+        MemoryModule* module;  // Модуль-поставщик
+        UInt32 ordinal;        // Ординал экспорта в этом модуле
+        FARPROC address;       // Готовый адрес (форвардер разрешён)
+    };
+    
+    explicit MemoryModuleSet(SymbolPrecedence precedence = SymbolPrecedence::FirstAdded) noexcept;
+    ~MemoryModuleSet() = default;
+    
+    MemoryModuleSet(const MemoryModuleSet&) = delete;
+    MemoryModuleSet& operator=(const MemoryModuleSet&) = delete;
+    
+    // Добавление загруженного модуля. Модуль по ссылке не должен выгружаться,
+    // пока он в наборе; модуль по unique_ptr принадлежит набору.
+    // priority учитывается при SymbolPrecedence::Priority. При ошибке
+    // переданный во владение модуль уничтожается.
+    bool Add(MemoryModule& module, int priority = 0) noexcept;
+    MemoryModule* Add(std::unique_ptr<MemoryModule> module, int priority = 0) noexcept;
+    
+    // Удаление модуля (принадлежащий набору модуль уничтожается)
+    bool Remove(const MemoryModule* module) noexcept;
+    
+    // Правило выбора, если имя экспортируют несколько модулей
+    void SetPrecedence(SymbolPrecedence precedence) noexcept;
+    
+    // Поиск по всему набору. Форвардеры разрешаются после снятия блокировки
+    // набора по скопированным тексту и резолверу, поэтому резолвер может сам
+    // обращаться к этому набору, а модуль - удаляться параллельно.
+    FARPROC GetProcAddress(const char* name) const noexcept;
+    FARPROC GetProcAddress(const SymbolKey& key) const noexcept;
+    bool FindSymbol(const SymbolKey& key, Symbol& symbol) const noexcept;
+    
+    // Все модули, экспортирующие имя, в порядке правила
+    std::vector<Symbol> FindAllSymbols(const SymbolKey& key) const noexcept;
+    
+    // Размеры
+    size_t GetModuleCount() const noexcept;
+    size_t GetSymbolCount() const noexcept;
+    
+private:
+    // Результат, собранный под блокировкой; форвардер разрешается после неё
+    struct PendingSymbol {
+        Symbol symbol{};
+        std::string forwarder;        // Пусто - адрес уже готов
+        ForwarderResolver resolver;
+        ForwarderScope scope = kDefaultForwarderScope;
+    };
+    
+    bool AddModule(MemoryModule* module, std::unique_ptr<MemoryModule> owned, int priority) noexcept;
+    void PrepareSymbol(const SymbolNamespace::Provider& provider, PendingSymbol& pending) const;
+    Symbol FinishSymbol(PendingSymbol& pending) const noexcept;
+    
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<const MemoryModule*, std::unique_ptr<MemoryModule>> modules_;
+    SymbolNamespace symbols_;
+};
+
+// Модуль с горячей перезагрузкой. Reload загружает новую версию рядом со
+// старой, строит её индекс экспортов и публикует адреса в ячейки таблицы
+// (как GOT): вызывающий держит ячейку и читает адрес перед каждым вызовом.
+// Старая версия выгружается, когда из неё вышли все читатели (RCU):
+// вызовы через ячейки и работа с Current() выполняются под ReadGuard.
+// Читатели не блокируются никогда; ждёт только поток, вызвавший Reload.
+class ReloadableModule {
+public:
+    // Ячейка адреса экспорта; адрес ячейки стабилен, пока жив ReloadableModule
+    using Slot = std::atomic<FARPROC>;
+    
+    // Секция чтения: пока объект жив, текущая версия не выгружается.
+    // Вложенные секции допустимы; Reload/Unload внутри секции - взаимоблокировка.
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const ReloadableModule& owner) noexcept;
+        ~ReadGuard() noexcept;
+        
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        
+    private:
+        std::atomic<UInt64>* counter_;
+    };
+    
+    ReloadableModule() noexcept;
+    ~ReloadableModule() noexcept;
+    
+    ReloadableModule(const ReloadableModule&) = delete;
+    ReloadableModule& operator=(const ReloadableModule&) = delete;
+    
+    // Загрузка новой версии (первая - обычная загрузка). Если новая версия
+    // не загрузилась или в ней нет имени из выданных ячеек - остаётся прежняя.
+    // Возвращает управление после выгрузки старой версии.
+    bool Reload(const void* data, size_t size) noexcept;
+    bool Unload() noexcept;
+    
+    // Ячейка для имени (nullptr, если в текущей версии его нет)
+    const Slot* GetSlot(const char* name) noexcept;
+    
+    // Текущая версия (действительна только под ReadGuard)
+    MemoryModule* Current() const noexcept { return current_.load(std::memory_order_acquire); }
+    UInt64 GetVersion() const noexcept { return version_.load(std::memory_order_acquire); }
+    bool IsLoaded() const noexcept { return Current() != nullptr; }
+    
+private:
+    // Счётчики читателей по чётности эпохи, разнесённые по строкам кэша
+    static constexpr size_t kStripes = 8;
+    struct alignas(64) ReaderCount {
+        std::atomic<UInt64> value{0};
+    };
+    
+    // Смена эпохи и ожидание выхода читателей прежней
+    void Synchronize() noexcept;
+    
+    mutable ReaderCount readers_[2][kStripes];
+    std::atomic<UInt64> epoch_;
+    std::atomic<MemoryModule*> current_;
+    std::atomic<UInt64> version_;
+    
+    // Изменения (Reload, Unload, новые ячейки) - под мьютексом
+    std::mutex mutex_;
+    std::unique_ptr<MemoryModule> module_;
+    std::deque<Slot> slots_;
+    std::unordered_map<std::string, size_t> slot_index_;
+};
+
 // Утилиты для работы с PE
 namespace PEUtils {
     bool IsValidDOSHeader(const IMAGE_DOS_HEADER* header) noexcept;
@@ -186,7 +590,7 @@ namespace PEUtils {
 // Глобальные утилиты
 namespace Utils {
     std::string FormatAddress(void* address) noexcept;
-    std::string FormatOrdinal(UInt16 ordinal) noexcept;
+    std::string FormatOrdinal(UInt32 ordinal) noexcept;
     void PrintExportTable(const std::vector<ExportInfo>& exports) noexcept;
     void PrintModuleInfo(const MemoryModule& module) noexcept;
 }
@@ -199,21 +603,64 @@ extern "C" {
     MemoryModule::MemoryModule* memory_module_create() noexcept;
     void memory_module_destroy(MemoryModule::MemoryModule* module) noexcept;
     bool memory_module_load(MemoryModule::MemoryModule* module, const void* data, size_t size) noexcept;
+    bool memory_module_load_from_file(MemoryModule::MemoryModule* module, const char* path) noexcept;
+    // adopt != 0 - буфер из VirtualAlloc переходит модулю
+    bool memory_module_load_from_mapped_layout(MemoryModule::MemoryModule* module, void* image, size_t size,
+                                               int adopt) noexcept;
+    bool memory_module_load_from_owned_buffer(MemoryModule::MemoryModule* module, void* buffer, size_t size,
+                                              size_t capacity, int adopt) noexcept;
     FARPROC memory_module_get_proc_address(MemoryModule::MemoryModule* module, const char* name) noexcept;
+    size_t memory_module_resolve_many(MemoryModule::MemoryModule* module, const char* const* names, 
+                                      FARPROC* out, size_t count) noexcept;
     bool memory_module_unload(MemoryModule::MemoryModule* module) noexcept;
     bool memory_module_is_64bit(MemoryModule::MemoryModule* module) noexcept;
     
     // Функции для работы с экспортами
     size_t memory_module_get_export_count(MemoryModule::MemoryModule* module) noexcept;
+    // *count: на входе - ёмкость exports, на выходе - общее число экспортов
+    // (exports == nullptr - только число)
     void memory_module_get_export_list(MemoryModule::MemoryModule* module, 
                                       MemoryModule::ExportInfo* exports, 
                                       size_t* count) noexcept;
     FARPROC memory_module_get_proc_address_by_ordinal(MemoryModule::MemoryModule* module, 
-                                                     MemoryModule::UInt16 ordinal) noexcept;
+                                                     MemoryModule::UInt32 ordinal) noexcept;
     const char* memory_module_get_function_name(MemoryModule::MemoryModule* module, 
-                                               MemoryModule::UInt16 ordinal) noexcept;
-    MemoryModule::UInt16 memory_module_get_function_ordinal(MemoryModule::MemoryModule* module, 
+                                               MemoryModule::UInt32 ordinal) noexcept;
+    MemoryModule::UInt32 memory_module_get_function_ordinal(MemoryModule::MemoryModule* module, 
                                              const char* name) noexcept;
+    
+    // Перечисление по префиксу/шаблону; callback возвращает false для остановки.
+    // name указывает в образ и не завершается нулём - длина в name_length.
+    // address - готовый адрес, как у get_proc_address: форвардер разрешён
+    // (nullptr, если цель не найдена), при включённых счётчиках - переходник.
+    typedef bool (*memory_module_export_callback)(const char* name, size_t name_length,
+                                                  MemoryModule::UInt32 ordinal, FARPROC address,
+                                                  void* context);
+    size_t memory_module_enumerate_exports(MemoryModule::MemoryModule* module, const char* pattern,
+                                           memory_module_export_callback callback, void* context) noexcept;
+    
+    // Счётчики вызовов экспортов; get_call_stats возвращает общее число записей
+    // и заполняет не больше capacity (name указывает в образ, без завершающего нуля)
+    typedef struct memory_module_call_stats {
+        MemoryModule::UInt32 ordinal;
+        const char* name;
+        size_t name_length;
+        MemoryModule::UInt64 calls;
+    } memory_module_call_stats;
+    
+    bool memory_module_enable_call_counting(MemoryModule::MemoryModule* module) noexcept;
+    MemoryModule::UInt64 memory_module_get_call_count(MemoryModule::MemoryModule* module, const char* name) noexcept;
+    size_t memory_module_get_call_stats(MemoryModule::MemoryModule* module, memory_module_call_stats* stats,
+                                        size_t capacity) noexcept;
+    void memory_module_reset_call_stats(MemoryModule::MemoryModule* module) noexcept;
+    
+    // Набор модулей с общим пространством имён (модули добавляются по ссылке)
+    MemoryModule::MemoryModuleSet* memory_module_set_create() noexcept;
+    void memory_module_set_destroy(MemoryModule::MemoryModuleSet* set) noexcept;
+    bool memory_module_set_add(MemoryModule::MemoryModuleSet* set, MemoryModule::MemoryModule* module,
+                               int priority) noexcept;
+    bool memory_module_set_remove(MemoryModule::MemoryModuleSet* set, MemoryModule::MemoryModule* module) noexcept;
+    FARPROC memory_module_set_get_proc_address(MemoryModule::MemoryModuleSet* set, const char* name) noexcept;
 }
 
 // Restore warnings for MSVC
@@ -0,0 +1,325 @@
+﻿/**
+ * @file xMemModBindgen.cpp
+ * @brief Генератор привязок экспортов DLL по ординалам
+ * @details Читает PE-образ кодом разбора библиотеки и выпускает заголовок
+ *          C++ с типизированной структурой указателей на функции, constexpr
+ *          ординалами и отпечатком образа. Сгенерированный Bind(module)
+ *          заполняет структуру через GetProcAddressByOrdinal (O(1)) и
+ *          проверяет отпечаток. Инструмент и сгенерированный код
+ *          собираются на Windows и Linux.
+ *
+ *          Сборка: цель xMemModBindgen в CMakeLists.txt или
+ *            g++ -std=c++17 -O2 xMemModBindgen.cpp xMemModImage.cpp
+ *                xMemModExports.cpp xMemModIndexFile.cpp -o xMemModBindgen
+ *
+ *          Использование:
+ *            xMemModBindgen <image.dll> <output.h> [--namespace=Name] [--signatures=file]
+ *
+ *          Файл сигнатур: строки "Имя = тип функции", например
+ *            Init = int(const char* config)
+ *            Shutdown = void __stdcall()
+ *          Экспорты без сигнатуры получают тип void().
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModImage.h"
+#include "xMemModExports.h"
+#include "xMemModIndexFile.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace MemoryModule;
+
+namespace {
+
+// Экспорт, попадающий в привязку
+struct BoundExport {
+    UInt32 ordinal;
+    std::string name;        // Имя в образе (пустое для экспорта по ординалу)
+    std::string identifier;  // Имя члена структуры
+    std::string signature;   // Тип функции
+};
+
+// Чтение файла целиком
+bool ReadWholeFile(const std::string& path, std::vector<UInt8>& data) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Обрезка пробелов
+std::string Trim(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    size_t end = text.find_last_not_of(" \t\r\n");
+    return text.substr(begin, end - begin + 1);
+}
+
+// Сигнатуры "Имя = тип функции"; '#' - комментарий
+bool ReadSignatures(const std::string& path, std::map<std::string, std::string>& signatures) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    
+    std::string line;
+    while (std::getline(file, line)) {
+        line = Trim(line.substr(0, line.find('#')));
+        size_t separator = line.find('=');
+        if (line.empty() || separator == std::string::npos) {
+            continue;
+        }
+        
+        signatures[Trim(line.substr(0, separator))] = Trim(line.substr(separator + 1));
+    }
+    
+    return true;
+}
+
+// Имя экспорта -> идентификатор C++ (декорированные имена вроде "?Init@@YAHXZ"
+// и ключевые слова тоже должны давать корректный член структуры)
+std::string MakeIdentifier(const std::string& name, UInt32 ordinal, std::set<std::string>& used) {
+    static const std::set<std::string> kReserved = {
+        // Ключевые слова и альтернативные операторы C++20
+        "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break",
+        "case", "catch", "char", "char8_t", "char16_t", "char32_t", "class", "compl", "concept",
+        "const", "consteval", "constexpr", "constinit", "const_cast", "continue", "co_await",
+        "co_return", "co_yield", "decltype", "default", "delete", "do", "double", "dynamic_cast",
+        "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto",
+        "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq",
+        "nullptr", "operator", "or", "or_eq", "private", "protected", "public", "register",
+        "reinterpret_cast", "requires", "return", "short", "signed", "sizeof", "static",
+        "static_assert", "static_cast", "struct", "switch", "template", "this", "thread_local",
+        "throw", "true", "try", "typedef", "typeid", "typename", "union", "unsigned", "using",
+        "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq",
+        // Макросы стандартной библиотеки и <windows.h> (без NOMINMAX)
+        "NULL", "EOF", "errno", "assert", "offsetof", "stdin", "stdout", "stderr", "min", "max",
+        // Имена, которые видны в сгенерированной структуре Api
+        "Api", "Bind", "BindOne", "Types", "Ordinals", "kFingerprint", "Module", "Function",
+        "MemoryModule", "module_", "complete_", "ordinal_", "target_", "address_"
+    };
+    
+    // Недопустимые символы -> '_', без "__" подряд (такие имена зарезервированы)
+    std::string identifier;
+    for (char c : name) {
+        char symbol = std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+        if (symbol != '_' || identifier.empty() || identifier.back() != '_') {
+            identifier += symbol;
+        }
+    }
+    
+    if (identifier.empty()) {
+        identifier = "Ordinal_" + std::to_string(ordinal);
+    } else if (std::isdigit(static_cast<unsigned char>(identifier[0]))) {
+        identifier = "_" + identifier;
+    }
+    
+    // Идентификаторы с "__" или "_X" зарезервированы реализацией
+    while (identifier.size() > 1 && identifier[0] == '_' &&
+           (identifier[1] == '_' || std::isupper(static_cast<unsigned char>(identifier[1])))) {
+        identifier.erase(0, 1);
+    }
+    
+    // Суффиксы тоже не дают "__": к имени на '_' добавляется только цифра
+    bool trailing = identifier.back() == '_';
+    if (kReserved.count(identifier) != 0) {
+        identifier += trailing ? "1" : "_";
+        trailing = !trailing;
+    }
+    
+    std::string unique = identifier;
+    for (int suffix = 2; used.count(unique) != 0 || kReserved.count(unique) != 0; ++suffix) {
+        unique = identifier + (trailing ? "" : "_") + std::to_string(suffix);
+    }
+    used.insert(unique);
+    return unique;
+}
+
+// Имя файла без каталога
+std::string FileName(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    return path.substr(slash == std::string::npos ? 0 : slash + 1);
+}
+
+// Имя пространства имён по имени файла
+std::string DefaultNamespace(const std::string& path) {
+    std::string file = FileName(path);
+    file = file.substr(0, file.find('.'));
+    
+    std::set<std::string> used;
+    return MakeIdentifier(file + "Binding", 0, used);
+}
+
+// Текст заголовка
+std::string Generate(const std::string& header_name, const std::string& image_name, const std::string& name_space,
+                     UInt64 fingerprint, const std::vector<BoundExport>& exports) {
+    std::ostringstream out;
+    char key[32];
+    snprintf(key, sizeof(key), "0x%016llXull", static_cast<unsigned long long>(fingerprint));
+    
+    out << "/**\n"
+        << " * @file " << header_name << "\n"
+        << " * @brief Привязка экспортов " << image_name << " по ординалам\n"
+        << " * @details Сгенерировано xMemModBindgen - не редактировать вручную.\n"
+        << " */\n\n"
+        << "#pragma once\n\n"
+        << "#include \"xMemModTypes.h\"\n\n"
+        << "namespace " << name_space << " {\n\n"
+        << "// Отпечаток образа (MemoryModule::GetExportIndexKey)\n"
+        << "constexpr MemoryModule::UInt64 kFingerprint = " << key << ";\n\n"
+        << "// Ординалы экспортов\n"
+        << "namespace Ordinals {\n";
+    
+    for (const auto& entry : exports) {
+        out << "    constexpr MemoryModule::UInt32 " << entry.identifier << " = " << entry.ordinal << ";";
+        if (!entry.name.empty() && entry.name != entry.identifier) {
+            out << "  // " << entry.name;
+        }
+        out << "\n";
+    }
+    
+    out << "}\n\n"
+        << "// Типы функций\n"
+        << "namespace Types {\n";
+    
+    for (const auto& entry : exports) {
+        out << "    using " << entry.identifier << " = " << entry.signature << ";\n";
+    }
+    
+    out << "}\n\n"
+        << "// Таблица функций\n"
+        << "struct Api {\n";
+    
+    for (const auto& entry : exports) {
+        out << "    Types::" << entry.identifier << "* " << entry.identifier << " = nullptr;\n";
+    }
+    
+    out << "\n"
+        << "    // Заполнение по ординалам. false - отпечаток не совпал (образ другой\n"
+        << "    // сборки) или часть экспортов не найдена. Module - MemoryModule или тип\n"
+        << "    // с GetExportIndexKey() и GetProcAddressByOrdinal(UInt32).\n"
+        << "    template <typename Module>\n"
+        << "    bool Bind(Module& module_) noexcept {\n"
+        << "        if (module_.GetExportIndexKey() != kFingerprint) {\n"
+        << "            return false;\n"
+        << "        }\n\n"
+        << "        bool complete_ = true;\n";
+    
+    for (const auto& entry : exports) {
+        out << "        complete_ &= BindOne(module_, Ordinals::" << entry.identifier << ", "
+            << entry.identifier << ");\n";
+    }
+    
+    out << "        return complete_;\n"
+        << "    }\n\n"
+        << "private:\n"
+        << "    template <typename Module, typename Function>\n"
+        << "    static bool BindOne(Module& module_, MemoryModule::UInt32 ordinal_, Function*& target_) noexcept {\n"
+        << "        auto address_ = module_.GetProcAddressByOrdinal(ordinal_);\n"
+        << "        target_ = reinterpret_cast<Function*>(address_);\n"
+        << "        return address_ != nullptr;\n"
+        << "    }\n"
+        << "};\n\n"
+        << "} // namespace " << name_space << "\n";
+    
+    return out.str();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Использование: xMemModBindgen <image.dll> <output.h> "
+                     "[--namespace=Name] [--signatures=file]" << std::endl;
+        return 2;
+    }
+    
+    std::string image_path = argv[1];
+    std::string output_path = argv[2];
+    std::string name_space = DefaultNamespace(image_path);
+    std::map<std::string, std::string> signatures;
+    
+    for (int i = 3; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option.rfind("--namespace=", 0) == 0) {
+            name_space = option.substr(12);
+        } else if (option.rfind("--signatures=", 0) == 0) {
+            if (!ReadSignatures(option.substr(13), signatures)) {
+                std::cerr << "Не удалось прочитать сигнатуры: " << option.substr(13) << std::endl;
+                return 1;
+            }
+        } else {
+            std::cerr << "Неизвестный параметр: " << option << std::endl;
+            return 2;
+        }
+    }
+    
+    // Образ раскладывается по RVA тем же способом, что и при загрузке
+    std::vector<UInt8> file;
+    std::vector<UInt8> image;
+    ImageLayout layout;
+    if (!ReadWholeFile(image_path, file) || !ImageLayout::Parse(file.data(), file.size(), layout) ||
+        !layout.Map(file.data(), file.size(), image)) {
+        std::cerr << "Не удалось разобрать PE-образ: " << image_path << std::endl;
+        return 1;
+    }
+    
+    const ImageDataDirectory& export_entry = layout.directories[ImageDirectory::kExport];
+    ExportDirectory directory;
+    ExportTable table;
+    if (!ExportDirectory::Read(image.data(), image.size(), export_entry.rva, export_entry.size, directory) ||
+        !table.Build(directory)) {
+        std::cerr << "В образе нет корректной таблицы экспортов: " << image_path << std::endl;
+        return 1;
+    }
+    
+    ImageFingerprint fingerprint{layout.size_of_image, layout.time_date_stamp, layout.checksum};
+    UInt64 key = ExportIndexKey(directory, fingerprint);
+    
+    // Экспорты по возрастанию ординала - вывод не зависит от раскладки индекса
+    std::vector<BoundExport> exports;
+    for (const auto& entry : table.view) {
+        exports.push_back(BoundExport{entry.ordinal, std::string(entry.name), "", ""});
+    }
+    std::stable_sort(exports.begin(), exports.end(), [](const BoundExport& left, const BoundExport& right) {
+        return left.ordinal < right.ordinal;
+    });
+    
+    std::set<std::string> used;
+    for (auto& entry : exports) {
+        entry.identifier = MakeIdentifier(entry.name, entry.ordinal, used);
+        
+        auto signature = signatures.find(entry.name.empty() ? entry.identifier : entry.name);
+        entry.signature = (signature != signatures.end()) ? signature->second : "void()";
+    }
+    
+    std::ofstream output(output_path, std::ios::binary);
+    output << Generate(FileName(output_path), FileName(image_path), name_space, key, exports);
+    if (!output) {
+        std::cerr << "Не удалось записать " << output_path << std::endl;
+        return 1;
+    }
+    
+    std::cout << output_path << ": " << exports.size() << " экспортов" << std::endl;
+    return 0;
+}
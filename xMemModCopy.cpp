@@ -0,0 +1,132 @@
+﻿/**
+ * @file xMemModCopy.cpp
+ * @brief MemoryModule - Реализация копирования секций образа
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModCopy.h"
+#include "xMemModParallel.h"
+#include "xMemModSimd.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace MemoryModule {
+
+namespace {
+    constexpr size_t kPageSize = 4096;
+    
+    // Кусок области для одного потока
+    struct CopyChunk {
+        UInt8* destination;
+        const UInt8* source;
+        size_t size;
+        bool streaming;
+    };
+    
+    void CopyChunks(const CopyChunk* chunks, size_t begin, size_t end) noexcept {
+        for (size_t i = begin; i < end; ++i) {
+            if (chunks[i].streaming) {
+                StreamCopy(chunks[i].destination, chunks[i].source, chunks[i].size);
+            } else {
+                memcpy(chunks[i].destination, chunks[i].source, chunks[i].size);
+            }
+        }
+    }
+}
+
+// Потоковое копирование: выравнивание приёмника, блоки по 64 байта, хвост
+void StreamCopy(void* destination, const void* source, size_t size) noexcept {
+    auto* dst = static_cast<UInt8*>(destination);
+    auto* src = static_cast<const UInt8*>(source);
+    
+#ifdef XMEMMOD_SSE2
+    size_t head = (16 - (reinterpret_cast<uintptr_t>(dst) & 15)) & 15;
+    if (size < head + 64) {
+        memcpy(dst, src, size);
+        return;
+    }
+    
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    size -= head;
+    
+    for (; size >= 64; size -= 64, dst += 64, src += 64) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48), d);
+    }
+    
+    // Потоковые записи слабо упорядочены - завершаем их до выхода
+    _mm_sfence();
+#endif
+    
+    memcpy(dst, src, size);
+}
+
+// Копирование областей: мелкие - сразу, крупные - кусками на пуле потоков
+void CopyRegions(const CopyRegion* regions, size_t count, const CopyOptions& options) noexcept {
+    size_t chunk_size = std::max(kPageSize, options.chunk_size & ~(kPageSize - 1));
+    size_t workers = options.max_workers != 0 ? options.max_workers : DefaultWorkerCount();
+    
+    try {
+        std::vector<CopyChunk> chunks;
+        
+        for (size_t i = 0; i < count; ++i) {
+            auto* dst = static_cast<UInt8*>(regions[i].destination);
+            auto* src = static_cast<const UInt8*>(regions[i].source);
+            size_t size = regions[i].size;
+            bool streaming = size >= options.streaming_threshold;
+            
+            if (workers <= 1 || size < options.parallel_threshold) {
+                CopyChunk chunk{dst, src, size, streaming};
+                CopyChunks(&chunk, 0, 1);
+                continue;
+            }
+            
+            // Границы кусков совпадают с границами страниц приёмника
+            size_t offset = 0;
+            size_t first = (kPageSize - (reinterpret_cast<uintptr_t>(dst) & (kPageSize - 1))) & (kPageSize - 1);
+            if (first != 0) {
+                chunks.push_back(CopyChunk{dst, src, std::min(first, size), streaming});
+                offset = std::min(first, size);
+            }
+            for (; offset < size; offset += chunk_size) {
+                chunks.push_back(CopyChunk{dst + offset, src + offset, std::min(chunk_size, size - offset), streaming});
+            }
+        }
+        
+        if (chunks.empty()) {
+            return;
+        }
+        
+        // Повторное копирование безопасно - при сбое запуска потоков всё делает текущий
+        try {
+            ParallelFor(chunks.size(), workers, [&chunks](size_t begin, size_t end) {
+                CopyChunks(chunks.data(), begin, end);
+            });
+        } catch (...) {
+            CopyChunks(chunks.data(), 0, chunks.size());
+        }
+        
+    } catch (...) {
+        // Нет памяти под список кусков - по одной области без потоков
+        for (size_t i = 0; i < count; ++i) {
+            memcpy(regions[i].destination, regions[i].source, regions[i].size);
+        }
+    }
+}
+
+} // namespace MemoryModule
@@ -0,0 +1,43 @@
+/**
+ * @file xMemModCopy.h
+ * @brief MemoryModule - Копирование больших секций образа
+ * @details Крупные области делятся на куски по границам страниц и копируются
+ *          параллельно; начиная с порога используются потоковые (non-temporal)
+ *          записи, не вытесняющие кэш вызывающего. Не зависит от Windows SDK.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include "xMemModTypes.h"
+
+namespace MemoryModule {
+
+// Настройки копирования секций
+struct CopyOptions {
+    size_t parallel_threshold = 16u << 20;   // Области меньше - одним memcpy в текущем потоке
+    size_t streaming_threshold = 4u << 20;   // Области от этого размера - потоковыми записями
+    size_t chunk_size = 4u << 20;            // Кусок для одного потока (кратен странице)
+    size_t max_workers = 0;                  // 0 - DefaultWorkerCount(); 1 - без потоков
+};
+
+// Область копирования
+struct CopyRegion {
+    void* destination;
+    const void* source;
+    size_t size;
+};
+
+// Копирование в обход кэша (где нет SIMD - обычный memcpy)
+void StreamCopy(void* destination, const void* source, size_t size) noexcept;
+
+// Копирование набора непересекающихся областей по настройкам. Если потоки
+// создать не удалось, всё копируется в текущем потоке.
+void CopyRegions(const CopyRegion* regions, size_t count, const CopyOptions& options) noexcept;
+
+} // namespace MemoryModule
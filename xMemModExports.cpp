@@ -0,0 +1,1289 @@
+﻿/**
+ * @file xMemModExports.cpp
+ * @brief MemoryModule - Реализация платформонезависимого индекса экспортов
+ * @details Современная реализация C++17/20, не требует Windows SDK
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ */
+
+#include "xMemModExports.h"
+#include "xMemModParallel.h"
+#include "xMemModSimd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <mutex>
+
+namespace MemoryModule {
+
+namespace SymbolHash {
+    namespace {
+#ifdef XMEMMOD_X86
+        // CRC32C аппаратно: то же обновление, что и табличное в Hash()
+        XMEMMOD_TARGET_SSE42 UInt32 HashSse42(const char* name, size_t length) noexcept {
+            UInt32 crc = 0xFFFFFFFFu;
+            size_t i = 0;
+    #ifdef XMEMMOD_X64
+            UInt64 crc64 = crc;
+            for (; i + 8 <= length; i += 8) {
+                UInt64 chunk;
+                memcpy(&chunk, name + i, sizeof(chunk));
+                crc64 = _mm_crc32_u64(crc64, chunk);
+            }
+            crc = static_cast<UInt32>(crc64);
+    #endif
+            for (; i + 4 <= length; i += 4) {
+                UInt32 chunk;
+                memcpy(&chunk, name + i, sizeof(chunk));
+                crc = _mm_crc32_u32(crc, chunk);
+            }
+            for (; i < length; ++i) {
+                crc = _mm_crc32_u8(crc, static_cast<UInt8>(name[i]));
+            }
+            return Detail::Mix(~crc);
+        }
+#endif
+    }
+    
+    UInt32 HashFast(const char* name, size_t length) noexcept {
+#ifdef XMEMMOD_X86
+        static const bool has_sse42 = Cpu::GetFeatures().sse42;
+        if (has_sse42) {
+            return HashSse42(name, length);
+        }
+#endif
+        return Hash(name, length);
+    }
+}
+
+namespace {
+    // Проверка, что диапазон [offset, offset + count * element_size) лежит в образе
+    bool IsRangeInImage(size_t image_size, UInt64 offset, UInt64 count, UInt64 element_size) noexcept {
+        UInt64 bytes = count * element_size;
+        return offset <= image_size && bytes <= image_size - offset;
+    }
+    
+    // Сравнение как у strcmp (побайтово без знака), имя из образа - с длиной
+    int CompareNames(const char* left, size_t left_length, const char* right, size_t right_length) noexcept {
+        size_t common = left_length < right_length ? left_length : right_length;
+        int result = memcmp(left, right, common);
+        if (result != 0) {
+            return result;
+        }
+        return (left_length < right_length) ? -1 : (left_length > right_length ? 1 : 0);
+    }
+}
+
+// Чтение каталога экспортов
+bool ExportDirectory::Read(const void* image_base, size_t image_size,
+                           UInt32 rva, UInt32 size, ExportDirectory& out) noexcept {
+    out = ExportDirectory();
+    
+    if (!image_base || rva == 0 || !IsRangeInImage(image_size, rva, 1, sizeof(RawExportDirectory))) {
+        return false;
+    }
+    
+    const UInt8* base = static_cast<const UInt8*>(image_base);
+    RawExportDirectory raw;
+    memcpy(&raw, base + rva, sizeof(raw));
+    
+    if (!IsRangeInImage(image_size, raw.AddressOfFunctions, raw.NumberOfFunctions, sizeof(UInt32)) ||
+        !IsRangeInImage(image_size, raw.AddressOfNames, raw.NumberOfNames, sizeof(UInt32)) ||
+        !IsRangeInImage(image_size, raw.AddressOfNameOrdinals, raw.NumberOfNames, sizeof(UInt16))) {
+        return false;
+    }
+    
+    out.image_base = base;
+    out.image_size = image_size;
+    out.directory_rva = rva;
+    out.directory_size = size;
+    out.ordinal_base = raw.Base;
+    out.number_of_functions = raw.NumberOfFunctions;
+    out.number_of_names = raw.NumberOfNames;
+    out.functions = reinterpret_cast<const UInt32*>(base + raw.AddressOfFunctions);
+    out.names = reinterpret_cast<const UInt32*>(base + raw.AddressOfNames);
+    out.name_ordinals = reinterpret_cast<const UInt16*>(base + raw.AddressOfNameOrdinals);
+    return true;
+}
+
+// Имя по индексу в AddressOfNames
+const char* ExportDirectory::NameAt(UInt32 index, size_t* length) const noexcept {
+    if (index >= number_of_names) {
+        return nullptr;
+    }
+    
+    UInt32 name_rva = names[index];
+    if (name_rva == 0 || name_rva >= image_size) {
+        return nullptr;
+    }
+    
+    const char* name = reinterpret_cast<const char*>(image_base + name_rva);
+    const void* terminator = memchr(name, '\0', image_size - name_rva);
+    if (!terminator) {
+        return nullptr;
+    }
+    
+    if (length) {
+        *length = static_cast<const char*>(terminator) - name;
+    }
+    return name;
+}
+
+// Поиск имени без индекса
+UInt32 ExportDirectory::FindName(const char* name, size_t length, NameOrder& order) const noexcept {
+    if (!name || number_of_names == 0) {
+        return ExportIndex::kNotFound;
+    }
+    
+    if (order == NameOrder::Unsorted) {
+        return FindNameLinear(name, length);
+    }
+    
+    bool order_violation = false;
+    UInt32 index = FindNameBinary(name, length, &order_violation);
+    if (index != ExportIndex::kNotFound && !order_violation) {
+        return index;
+    }
+    
+    // Промах или подозрение на неотсортированную таблицу: один раз проверяем порядок
+    if (order == NameOrder::Unknown || order_violation) {
+        order = IsNameTableSorted() ? NameOrder::Sorted : NameOrder::Unsorted;
+    }
+    
+    return order == NameOrder::Sorted ? index : FindNameLinear(name, length);
+}
+
+// Двоичный поиск по AddressOfNames
+UInt32 ExportDirectory::FindNameBinary(const char* name, size_t length, bool* order_violation) const noexcept {
+    UInt32 low = 0;
+    UInt32 high = number_of_names;
+    const char* low_name = nullptr;
+    size_t low_length = 0;
+    
+    while (low < high) {
+        UInt32 middle = low + (high - low) / 2;
+        size_t middle_length = 0;
+        const char* middle_name = NameAt(middle, &middle_length);
+        
+        if (!middle_name) {
+            if (order_violation) *order_violation = true;
+            return ExportIndex::kNotFound;
+        }
+        
+        // Дешёвая проверка порядка по пути поиска
+        if (low_name && CompareNames(low_name, low_length, middle_name, middle_length) > 0) {
+            if (order_violation) *order_violation = true;
+        }
+        
+        int result = CompareNames(middle_name, middle_length, name, length);
+        if (result == 0) {
+            // Первое из повторяющихся имён, как при линейном поиске
+            while (middle > 0) {
+                size_t previous_length = 0;
+                const char* previous = NameAt(middle - 1, &previous_length);
+                if (!previous || CompareNames(previous, previous_length, name, length) != 0) {
+                    break;
+                }
+                --middle;
+            }
+            return middle;
+        }
+        
+        if (result < 0) {
+            low = middle + 1;
+            low_name = middle_name;
+            low_length = middle_length;
+        } else {
+            high = middle;
+        }
+    }
+    
+    return ExportIndex::kNotFound;
+}
+
+// Линейный поиск по AddressOfNames
+UInt32 ExportDirectory::FindNameLinear(const char* name, size_t length) const noexcept {
+    for (UInt32 i = 0; i < number_of_names; ++i) {
+        size_t candidate_length = 0;
+        const char* candidate = NameAt(i, &candidate_length);
+        if (candidate && CompareNames(candidate, candidate_length, name, length) == 0) {
+            return i;
+        }
+    }
+    
+    return ExportIndex::kNotFound;
+}
+
+// Проверка сортировки таблицы имён
+bool ExportDirectory::IsNameTableSorted() const noexcept {
+    size_t previous_length = 0;
+    const char* previous = number_of_names ? NameAt(0, &previous_length) : nullptr;
+    
+    for (UInt32 i = 1; i < number_of_names; ++i) {
+        size_t current_length = 0;
+        const char* current = NameAt(i, &current_length);
+        if (!previous || !current || CompareNames(previous, previous_length, current, current_length) > 0) {
+            return false;
+        }
+        previous = current;
+        previous_length = current_length;
+    }
+    
+    return number_of_names == 0 || previous != nullptr;
+}
+
+// Строка форвардера по RVA
+std::string_view ExportDirectory::ForwarderAt(UInt32 rva) const noexcept {
+    if (!IsForwarder(rva) || rva >= image_size) {
+        return std::string_view();
+    }
+    
+    size_t limit = static_cast<size_t>(directory_rva) + directory_size - rva;
+    if (limit > image_size - rva) {
+        limit = image_size - rva;
+    }
+    
+    const char* text = reinterpret_cast<const char*>(image_base + rva);
+    const void* terminator = memchr(text, '\0', limit);
+    if (!terminator) {
+        return std::string_view();
+    }
+    
+    return std::string_view(text, static_cast<const char*>(terminator) - text);
+}
+
+// Разбор строки форвардера
+bool ParseForwarder(std::string_view text, ForwarderTarget& target) noexcept {
+    target = ForwarderTarget{std::string_view(), std::string_view(), 0, false};
+    
+    size_t dot = text.find('.');
+    if (dot == 0 || dot == std::string_view::npos || dot + 1 >= text.size()) {
+        return false;
+    }
+    
+    target.module = text.substr(0, dot);
+    std::string_view symbol = text.substr(dot + 1);
+    
+    if (symbol[0] != '#') {
+        target.symbol = symbol;
+        return true;
+    }
+    
+    // Форвардер по ординалу: "MODULE.#12"
+    if (symbol.size() < 2 || symbol.size() > 6) {
+        return false;
+    }
+    
+    UInt32 ordinal = 0;
+    for (size_t i = 1; i < symbol.size(); ++i) {
+        if (symbol[i] < '0' || symbol[i] > '9') {
+            return false;
+        }
+        ordinal = ordinal * 10 + static_cast<UInt32>(symbol[i] - '0');
+    }
+    
+    target.ordinal = ordinal;
+    target.by_ordinal = true;
+    return ordinal <= 0xFFFF;
+}
+
+// Общий кэш форвардеров
+ForwarderCache& ForwarderCache::Instance() noexcept {
+    static ForwarderCache cache;
+    return cache;
+}
+
+// Новая область кэша
+ForwarderScope ForwarderCache::NewScope() noexcept {
+    static std::atomic<ForwarderScope> next(kDefaultForwarderScope + 1);
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Ключ: хеш имени модуля в нижнем регистре и хеш имени функции (или ординал),
+// перемешанные с областью
+UInt64 ForwarderCache::KeyOf(ForwarderScope scope, const ForwarderTarget& target) noexcept {
+    UInt32 crc = 0xFFFFFFFFu;
+    for (char c : target.module) {
+        UInt8 byte = static_cast<UInt8>(std::tolower(static_cast<unsigned char>(c)));
+        crc = SymbolHash::Detail::kCrc32cTable.values[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+    }
+    
+    UInt32 symbol_hash = target.by_ordinal
+        ? (0x80000000u | target.ordinal)
+        : SymbolHash::Hash(target.symbol.data(), target.symbol.size()) & 0x7FFFFFFFu;
+    UInt64 key = (static_cast<UInt64>(SymbolHash::Detail::Mix(~crc)) << 32) | symbol_hash;
+    return key ^ (scope * 0x9E3779B97F4A7C15ull);
+}
+
+// Проверка полного совпадения (ключ - только хеш)
+bool ForwarderCache::Matches(const Entry& entry, ForwarderScope scope, const ForwarderTarget& target) noexcept {
+    if (entry.scope != scope || entry.by_ordinal != target.by_ordinal || entry.module.size() != target.module.size()) {
+        return false;
+    }
+    
+    for (size_t i = 0; i < entry.module.size(); ++i) {
+        if (std::tolower(static_cast<unsigned char>(entry.module[i])) !=
+            std::tolower(static_cast<unsigned char>(target.module[i]))) {
+            return false;
+        }
+    }
+    
+    return entry.by_ordinal ? entry.ordinal == target.ordinal : entry.symbol == target.symbol;
+}
+
+// Поиск в кэше
+bool ForwarderCache::Find(ForwarderScope scope, const ForwarderTarget& target, const void*& address) const noexcept {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    auto it = entries_.find(KeyOf(scope, target));
+    if (it == entries_.end() || !Matches(it->second, scope, target)) {
+        return false;
+    }
+    
+    address = it->second.address;
+    return true;
+}
+
+// Запоминание результата (при коллизии ключа побеждает последний)
+void ForwarderCache::Insert(ForwarderScope scope, const ForwarderTarget& target, const void* address) noexcept {
+    try {
+        Entry entry{scope, std::string(target.module), std::string(target.symbol),
+                    target.ordinal, target.by_ordinal, address};
+        
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        entries_[KeyOf(scope, target)] = std::move(entry);
+        
+    } catch (...) {
+        // Кэш - только оптимизация: при нехватке памяти просто не запоминаем
+    }
+}
+
+// Удаление адресов внутри выгружаемого образа
+void ForwarderCache::Invalidate(const void* image_base, size_t image_size) noexcept {
+    uintptr_t begin = reinterpret_cast<uintptr_t>(image_base);
+    
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        uintptr_t address = reinterpret_cast<uintptr_t>(it->second.address);
+        if (address >= begin && address - begin < image_size) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// Удаление результатов одной области
+void ForwarderCache::InvalidateScope(ForwarderScope scope) noexcept {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.scope == scope) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// Очистка кэша
+void ForwarderCache::Clear() noexcept {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    entries_.clear();
+}
+
+// Размер кэша
+size_t ForwarderCache::Size() const noexcept {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return entries_.size();
+}
+
+// Разрешение форвардера
+const void* ResolveForwarder(std::string_view text, const ForwarderResolver& resolver,
+                             ForwarderScope scope) noexcept {
+    constexpr int kMaxForwarderDepth = 16;
+    thread_local int depth = 0;
+    
+    ForwarderTarget target;
+    if (!ParseForwarder(text, target)) {
+        return nullptr;
+    }
+    
+    ForwarderCache& cache = ForwarderCache::Instance();
+    const void* address = nullptr;
+    if (cache.Find(scope, target, address)) {
+        return address;
+    }
+    
+    if (!resolver || depth >= kMaxForwarderDepth) {
+        return nullptr;
+    }
+    
+    ++depth;
+    try {
+        address = resolver(target);
+    } catch (...) {
+        address = nullptr;
+    }
+    --depth;
+    
+    if (address) {
+        cache.Insert(scope, target, address);
+    }
+    return address;
+}
+
+// Пул имён символов
+SymbolPool& SymbolPool::Instance() noexcept {
+    static SymbolPool pool;
+    return pool;
+}
+
+// Освобождение узлов (при завершении процесса)
+SymbolPool::~SymbolPool() {
+    for (auto& bucket : buckets_) {
+        Node* node = bucket.load(std::memory_order_relaxed);
+        while (node) {
+            Node* next = node->next.load(std::memory_order_relaxed);
+            ::operator delete(node);
+            node = next;
+        }
+    }
+    
+    for (auto& chunk : chunks_) {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+// Поиск в цепочке корзины от node до stop (не включая)
+const SymbolPool::Node* SymbolPool::FindInChain(const Node* node, const Node* stop, const SymbolKey& key) noexcept {
+    for (; node != stop; node = node->next.load(std::memory_order_acquire)) {
+        if (node->hash == key.hash && node->length == key.length &&
+            memcmp(node->name, key.name, key.length) == 0) {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+// Узел по идентификатору
+const SymbolPool::Node* SymbolPool::NodeAt(SymbolId id) const noexcept {
+    UInt32 chunk_index = id / kChunkSize;
+    if (id == kInvalidSymbolId || chunk_index >= kMaxChunks) {
+        return nullptr;
+    }
+    
+    const std::atomic<Node*>* chunk = chunks_[chunk_index].load(std::memory_order_acquire);
+    return chunk ? chunk[id % kChunkSize].load(std::memory_order_acquire) : nullptr;
+}
+
+// Интернирование имени
+SymbolId SymbolPool::Intern(const SymbolKey& key) noexcept {
+    std::atomic<Node*>& bucket = buckets_[key.hash & (kBucketCount - 1)];
+    Node* head = bucket.load(std::memory_order_acquire);
+    const Node* stop = nullptr;
+    Node* node = nullptr;
+    
+    for (;;) {
+        // Проверяем только узлы, добавленные с прошлой попытки
+        if (const Node* found = FindInChain(head, stop, key)) {
+            if (node) {
+                // Проиграли гонку: идентификатор остаётся неиспользованным
+                chunks_[node->id / kChunkSize].load(std::memory_order_relaxed)[node->id % kChunkSize]
+                    .store(nullptr, std::memory_order_relaxed);
+                ::operator delete(node);
+            }
+            return found->id;
+        }
+        
+        if (!node) {
+            SymbolId id = next_id_.fetch_add(1, std::memory_order_relaxed);
+            UInt32 chunk_index = id / kChunkSize;
+            if (chunk_index >= kMaxChunks) {
+                return kInvalidSymbolId;
+            }
+            
+            // Блок идентификаторов создаётся тем, кто первым до него дошёл
+            std::atomic<Node*>* chunk = chunks_[chunk_index].load(std::memory_order_acquire);
+            if (!chunk) {
+                std::atomic<Node*>* fresh = new (std::nothrow) std::atomic<Node*>[kChunkSize]();
+                if (!fresh) {
+                    return kInvalidSymbolId;
+                }
+                if (chunks_[chunk_index].compare_exchange_strong(chunk, fresh, std::memory_order_acq_rel)) {
+                    chunk = fresh;
+                } else {
+                    delete[] fresh;
+                }
+            }
+            
+            void* memory = ::operator new(sizeof(Node) + key.length, std::nothrow);
+            if (!memory) {
+                return kInvalidSymbolId;
+            }
+            
+            node = new (memory) Node;
+            node->hash = key.hash;
+            node->length = key.length;
+            node->id = id;
+            memcpy(node->name, key.name, key.length);
+            node->name[key.length] = '\0';
+            
+            // Запись в блок - до публикации в корзине, чтобы Name(id) сразу работал
+            chunk[id % kChunkSize].store(node, std::memory_order_release);
+        }
+        
+        node->next.store(head, std::memory_order_relaxed);
+        stop = head;
+        if (bucket.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_acquire)) {
+            count_.fetch_add(1, std::memory_order_relaxed);
+            return node->id;
+        }
+    }
+}
+
+SymbolId SymbolPool::Intern(std::string_view name) noexcept {
+    SymbolKey key(name.data(), 0);
+    key.length = static_cast<UInt32>(name.size());
+    key.hash = SymbolHash::HashFast(name.data(), name.size());
+    return Intern(key);
+}
+
+// Поиск без добавления
+SymbolId SymbolPool::Find(const SymbolKey& key) const noexcept {
+    const Node* head = buckets_[key.hash & (kBucketCount - 1)].load(std::memory_order_acquire);
+    const Node* found = FindInChain(head, nullptr, key);
+    return found ? found->id : kInvalidSymbolId;
+}
+
+SymbolId SymbolPool::Find(std::string_view name) const noexcept {
+    SymbolKey key(name.data(), 0);
+    key.length = static_cast<UInt32>(name.size());
+    key.hash = SymbolHash::HashFast(name.data(), name.size());
+    return Find(key);
+}
+
+// Имя по идентификатору
+std::string_view SymbolPool::Name(SymbolId id) const noexcept {
+    const Node* node = NodeAt(id);
+    return node ? std::string_view(node->name, node->length) : std::string_view();
+}
+
+// Ключ по идентификатору (хеш уже посчитан при интернировании)
+SymbolKey SymbolPool::Key(SymbolId id) const noexcept {
+    SymbolKey key("", 0);
+    if (const Node* node = NodeAt(id)) {
+        key.name = node->name;
+        key.length = node->length;
+        key.hash = node->hash;
+    }
+    return key;
+}
+
+// Построение хеш-индекса
+bool ExportIndex::Build(const ExportDirectory& directory, UInt32 max_workers) noexcept {
+    try {
+        Clear();
+        
+        UInt32 count = directory.number_of_names;
+        if (count == 0) {
+            return true;
+        }
+        
+        size_t workers = max_workers;
+        if (workers == 0) {
+            workers = (count >= kParallelThreshold) ? DefaultWorkerCount() : 1;
+        }
+        
+        // Фаза 1: разбор имён и хеши. Потоки пишут в непересекающиеся диапазоны.
+        entries_.resize(count);
+        std::vector<UInt32> hashes(count);
+        
+        ParallelFor(count, workers, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                size_t length = 0;
+                const char* name = directory.NameAt(static_cast<UInt32>(i), &length);
+                UInt16 function_index = directory.name_ordinals[i];
+                
+                if (!name || function_index >= directory.number_of_functions) {
+                    entries_[i] = Entry{nullptr, 0, 0};
+                    continue;
+                }
+                
+                entries_[i] = Entry{name, static_cast<UInt32>(length), function_index};
+                hashes[i] = SymbolHash::HashFast(name, length);
+            }
+        });
+        
+        // Уплотнение (нужно только для повреждённых таблиц)
+        size_t valid = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (entries_[i].name) {
+                entries_[valid] = entries_[i];
+                hashes[valid] = hashes[i];
+                ++valid;
+            }
+        }
+        entries_.resize(valid);
+        
+        if (entries_.empty()) {
+            return true;
+        }
+        
+        // Ёмкость - степень двойки, заполнение не выше 50%
+        size_t capacity = 8;
+        while (capacity < entries_.size() * 2) {
+            capacity <<= 1;
+        }
+        
+        slots_.assign(capacity, Slot{0, 0});
+        mask_ = static_cast<UInt32>(capacity - 1);
+        
+        // Фаза 2: вставка. Таблица делится на регионы по числу потоков; каждый
+        // поток вставляет только записи со своей домашней ячейкой и пробирует
+        // в пределах региона, поэтому блокировки не нужны. Записи, которым не
+        // хватило места до конца региона, досыпаются последовательно.
+        // Записи заранее раскладываются по регионам сортировкой подсчётом,
+        // чтобы каждый поток проходил только свои, а не весь массив.
+        size_t regions = 1;
+        while (regions * 2 <= workers && capacity / (regions * 2) >= 1024) {
+            regions *= 2;
+        }
+        
+        if (regions == 1) {
+            for (UInt32 slot = 0; slot < Size(); ++slot) {
+                Insert(slot, hashes[slot]);
+            }
+            return true;
+        }
+        
+        size_t region_size = capacity / regions;
+        size_t region_shift = 0;
+        while ((static_cast<size_t>(1) << region_shift) < region_size) {
+            ++region_shift;
+        }
+        
+        // Гистограмма регионов по частям массива записей, затем смещения
+        // (регион, часть) и раскладка. Внутри региона порядок слотов сохраняется.
+        size_t total = Size();
+        size_t parts = std::min(workers, total);
+        size_t part_size = (total + parts - 1) / parts;
+        parts = (total + part_size - 1) / part_size;
+        
+        std::vector<UInt32> offsets(parts * regions, 0);
+        ParallelFor(parts, parts, [&](size_t begin, size_t end) {
+            for (size_t part = begin; part < end; ++part) {
+                size_t last = std::min(total, (part + 1) * part_size);
+                for (size_t slot = part * part_size; slot < last; ++slot) {
+                    ++offsets[part * regions + ((hashes[slot] & mask_) >> region_shift)];
+                }
+            }
+        });
+        
+        std::vector<UInt32> region_begin(regions + 1, 0);
+        UInt32 running = 0;
+        for (size_t region = 0; region < regions; ++region) {
+            region_begin[region] = running;
+            for (size_t part = 0; part < parts; ++part) {
+                UInt32 part_count = offsets[part * regions + region];
+                offsets[part * regions + region] = running;
+                running += part_count;
+            }
+        }
+        region_begin[regions] = running;
+        
+        std::vector<UInt32> order(total);
+        ParallelFor(parts, parts, [&](size_t begin, size_t end) {
+            for (size_t part = begin; part < end; ++part) {
+                size_t last = std::min(total, (part + 1) * part_size);
+                for (size_t slot = part * part_size; slot < last; ++slot) {
+                    order[offsets[part * regions + ((hashes[slot] & mask_) >> region_shift)]++] =
+                        static_cast<UInt32>(slot);
+                }
+            }
+        });
+        
+        std::vector<std::vector<UInt32>> overflow(regions);
+        std::atomic<bool> failed(false);
+        
+        ParallelFor(regions, regions, [&](size_t begin, size_t end) {
+            try {
+                for (size_t region = begin; region < end; ++region) {
+                    size_t region_end = (region + 1) * region_size;
+                    
+                    for (UInt32 i = region_begin[region]; i < region_begin[region + 1]; ++i) {
+                        UInt32 slot = order[i];
+                        size_t position = hashes[slot] & mask_;
+                        
+                        while (position < region_end && slots_[position].entry != 0) {
+                            ++position;
+                        }
+                        
+                        if (position == region_end) {
+                            overflow[region].push_back(slot);
+                        } else {
+                            slots_[position] = Slot{hashes[slot], slot + 1};
+                        }
+                    }
+                }
+            } catch (...) {
+                failed.store(true);
+            }
+        });
+        
+        if (failed.load()) {
+            Clear();
+            return false;
+        }
+        
+        // Переполнившиеся записи - в порядке слотов, чтобы среди одинаковых
+        // имён по-прежнему находилось первое
+        std::vector<UInt32> pending;
+        for (const auto& list : overflow) {
+            pending.insert(pending.end(), list.begin(), list.end());
+        }
+        std::sort(pending.begin(), pending.end());
+        
+        for (UInt32 slot : pending) {
+            Insert(slot, hashes[slot]);
+        }
+        
+        return true;
+        
+    } catch (...) {
+        Clear();
+        return false;
+    }
+}
+
+// Вставка слота линейным пробированием
+bool ExportIndex::Insert(UInt32 slot, UInt32 hash) noexcept {
+    UInt32 position = hash & mask_;
+    
+    while (slots_[position].entry != 0) {
+        position = (position + 1) & mask_;
+    }
+    
+    slots_[position] = Slot{hash, slot + 1};
+    return true;
+}
+
+// Очистка индекса
+void ExportIndex::Clear() noexcept {
+    slots_.clear();
+    entries_.clear();
+    mask_ = 0;
+}
+
+// Поиск по имени
+UInt32 ExportIndex::Find(const char* name) const noexcept {
+    if (!name) {
+        return kNotFound;
+    }
+    
+    size_t length = strlen(name);
+    return Find(name, length, SymbolHash::HashFast(name, length));
+}
+
+// Поиск по имени с заранее вычисленным хешем
+UInt32 ExportIndex::Find(const char* name, size_t length, UInt32 hash) const noexcept {
+    if (slots_.empty()) {
+        return kNotFound;
+    }
+    
+    UInt32 position = hash & mask_;
+    for (;;) {
+        const Slot& slot = slots_[position];
+        if (slot.entry == 0) {
+            return kNotFound;
+        }
+        
+        if (slot.hash == hash) {
+            const Entry& entry = entries_[slot.entry - 1];
+            if (entry.length == length && memcmp(entry.name, name, length) == 0) {
+                return slot.entry - 1;
+            }
+        }
+        
+        position = (position + 1) & mask_;
+    }
+}
+
+// Пакетный поиск
+void ExportIndex::FindMany(const char* const* names, UInt32* slots, size_t count) const noexcept {
+    constexpr size_t kBatch = 16;
+    
+    for (size_t start = 0; start < count; start += kBatch) {
+        size_t batch = (count - start < kBatch) ? count - start : kBatch;
+        UInt32 hashes[kBatch];
+        size_t lengths[kBatch];
+        
+        // Проход 1: хеши и предвыборка ячеек
+        for (size_t i = 0; i < batch; ++i) {
+            const char* name = names[start + i];
+            lengths[i] = name ? strlen(name) : 0;
+            hashes[i] = name ? SymbolHash::HashFast(name, lengths[i]) : 0;
+            if (name && !slots_.empty()) {
+                XMEMMOD_PREFETCH(&slots_[hashes[i] & mask_]);
+            }
+        }
+        
+        // Проход 2: пробирование (ячейки уже в кэше)
+        for (size_t i = 0; i < batch; ++i) {
+            const char* name = names[start + i];
+            slots[start + i] = name ? Find(name, lengths[i], hashes[i]) : kNotFound;
+        }
+    }
+}
+
+// Пакетный поиск по готовым ключам: хеши уже посчитаны, остаётся предвыборка
+void ExportIndex::FindMany(const SymbolKey* keys, UInt32* slots, size_t count) const noexcept {
+    constexpr size_t kBatch = 16;
+    
+    for (size_t start = 0; start < count; start += kBatch) {
+        size_t batch = (count - start < kBatch) ? count - start : kBatch;
+        
+        if (!slots_.empty()) {
+            for (size_t i = 0; i < batch; ++i) {
+                XMEMMOD_PREFETCH(&slots_[keys[start + i].hash & mask_]);
+            }
+        }
+        
+        for (size_t i = 0; i < batch; ++i) {
+            slots[start + i] = Find(keys[start + i]);
+        }
+    }
+}
+
+// Построение таблицы ординалов
+bool OrdinalTable::Build(const ExportDirectory& directory, const ExportIndex& index) noexcept {
+    try {
+        Clear();
+        
+        base_ = directory.ordinal_base;
+        entries_.resize(directory.number_of_functions, OrdinalEntry{nullptr, nullptr, 0, 0});
+        
+        for (UInt32 i = 0; i < directory.number_of_functions; ++i) {
+            UInt32 rva = directory.functions[i];
+            if (rva == 0 || rva >= directory.image_size) {
+                continue;
+            }
+            
+            entries_[i].rva = rva;
+            entries_[i].address = directory.image_base + rva;
+        }
+        
+        // Привязываем имена; при нескольких именах на ординал берём первое
+        for (UInt32 slot = 0; slot < index.Size(); ++slot) {
+            OrdinalEntry& entry = entries_[index.FunctionIndexAt(slot)];
+            if (entry.rva != 0 && !entry.name) {
+                entry.name = index.NameAt(slot);
+                entry.name_length = index.NameLengthAt(slot);
+            }
+        }
+        
+        return true;
+        
+    } catch (...) {
+        Clear();
+        return false;
+    }
+}
+
+// Очистка таблицы ординалов
+void OrdinalTable::Clear() noexcept {
+    entries_.clear();
+    base_ = 0;
+}
+
+// Построение представления экспортов
+bool ExportView::Build(const ExportIndex& index, const OrdinalTable& ordinals) noexcept {
+    try {
+        Clear();
+        
+        UInt32 unnamed_count = 0;
+        for (UInt32 position = 0; position < ordinals.Size(); ++position) {
+            const OrdinalEntry& entry = ordinals.At(position);
+            if (entry.rva != 0 && !entry.name) {
+                ++unnamed_count;
+            }
+        }
+        
+        size_t total = static_cast<size_t>(index.Size()) + unnamed_count;
+        ordinals_.reserve(total);
+        rvas_.reserve(total);
+        addresses_.reserve(total);
+        names_.reserve(total);
+        
+        // Именованные экспорты: позиция совпадает со слотом индекса
+        for (UInt32 slot = 0; slot < index.Size(); ++slot) {
+            UInt16 function_index = index.FunctionIndexAt(slot);
+            const OrdinalEntry& entry = ordinals.At(function_index);
+            
+            ordinals_.push_back(ordinals.Base() + function_index);
+            rvas_.push_back(entry.rva);
+            addresses_.push_back(entry.address);
+            names_.emplace_back(index.NameAt(slot), index.NameLengthAt(slot));
+        }
+        named_count_ = index.Size();
+        
+        // Экспорты только по ординалу
+        for (UInt32 position = 0; position < ordinals.Size(); ++position) {
+            const OrdinalEntry& entry = ordinals.At(position);
+            if (entry.rva == 0 || entry.name) {
+                continue;
+            }
+            
+            ordinals_.push_back(ordinals.Base() + position);
+            rvas_.push_back(entry.rva);
+            addresses_.push_back(entry.address);
+            names_.emplace_back();
+        }
+        
+        return true;
+        
+    } catch (...) {
+        Clear();
+        return false;
+    }
+}
+
+// Очистка представления
+void ExportView::Clear() noexcept {
+    ordinals_.clear();
+    rvas_.clear();
+    addresses_.clear();
+    names_.clear();
+    ids_.clear();
+    pool_ = nullptr;
+    named_count_ = 0;
+}
+
+// Идентификаторы именованных экспортов из пула вместо столбца имён:
+// 4 байта на экспорт вместо 16, а сами строки - одна копия на процесс
+bool ExportView::InternNames(SymbolPool& pool) noexcept {
+    if (pool_) {
+        return true;
+    }
+    
+    try {
+        std::vector<SymbolId> ids(ordinals_.size(), kInvalidSymbolId);
+        
+        for (UInt32 position = 0; position < named_count_; ++position) {
+            ids[position] = pool.Intern(names_[position]);
+            if (ids[position] == kInvalidSymbolId) {
+                return false;
+            }
+        }
+        
+        ids_ = std::move(ids);
+        std::vector<std::string_view>().swap(names_);
+        pool_ = &pool;
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Построение индекса адресов
+bool AddressIndex::Build(const ExportDirectory& directory, const ExportView& view) noexcept {
+    try {
+        Clear();
+        
+        image_size_ = static_cast<UInt32>(directory.image_size);
+        entries_.reserve(view.Size());
+        
+        UInt64 directory_end = static_cast<UInt64>(directory.directory_rva) + directory.directory_size;
+        for (UInt32 position = 0; position < view.Size(); ++position) {
+            UInt32 rva = view.Rvas()[position];
+            // Пустые ячейки и экспорты с RVA 0 не указывают ни на что в образе
+            if (rva == 0 || (rva >= directory.directory_rva && rva < directory_end)) {
+                continue;
+            }
+            entries_.push_back(Entry{rva, position});
+        }
+        
+        // Устойчивая сортировка: при равных RVA первым остаётся именованный экспорт
+        std::stable_sort(entries_.begin(), entries_.end(),
+                         [](const Entry& left, const Entry& right) { return left.rva < right.rva; });
+        entries_.erase(std::unique(entries_.begin(), entries_.end(),
+                                   [](const Entry& left, const Entry& right) { return left.rva == right.rva; }),
+                       entries_.end());
+        
+        return true;
+        
+    } catch (...) {
+        Clear();
+        return false;
+    }
+}
+
+// Очистка индекса адресов
+void AddressIndex::Clear() noexcept {
+    entries_.clear();
+    image_size_ = 0;
+}
+
+// Поиск экспорта, содержащего RVA
+bool AddressIndex::Find(UInt32 rva, const ExportView& view, ExportSymbol& symbol) const noexcept {
+    auto it = std::upper_bound(entries_.begin(), entries_.end(), rva,
+                               [](UInt32 value, const Entry& entry) { return value < entry.rva; });
+    if (it == entries_.begin()) {
+        return false;
+    }
+    
+    auto next = it;
+    --it;
+    
+    ExportView::Entry entry = view[it->position];
+    UInt32 end = (next != entries_.end()) ? next->rva : image_size_;
+    
+    symbol.position = it->position;
+    symbol.ordinal = entry.ordinal;
+    symbol.rva = it->rva;
+    symbol.offset = rva - it->rva;
+    symbol.size = end > it->rva ? end - it->rva : 0;
+    symbol.address = entry.address;
+    symbol.name = entry.name;
+    return true;
+}
+
+// Сопоставление с шаблоном (жадный '*' с откатом)
+bool MatchSymbolPattern(std::string_view pattern, std::string_view name) noexcept {
+    size_t p = 0;
+    size_t n = 0;
+    size_t star = std::string_view::npos;
+    size_t star_name = 0;
+    
+    while (n < name.size()) {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) {
+            ++p;
+            ++n;
+        } else if (p < pattern.size() && pattern[p] == '*') {
+            star = p++;
+            star_name = n;
+        } else if (star != std::string_view::npos) {
+            p = star + 1;
+            n = ++star_name;
+        } else {
+            return false;
+        }
+    }
+    
+    while (p < pattern.size() && pattern[p] == '*') {
+        ++p;
+    }
+    
+    return p == pattern.size();
+}
+
+// Построение упорядоченного по имени массива
+bool NameRangeIndex::Build(const ExportView& view) noexcept {
+    try {
+        Clear();
+        
+        positions_.resize(view.NamedCount());
+        for (UInt32 i = 0; i < view.NamedCount(); ++i) {
+            positions_[i] = i;
+        }
+        
+        // Обычно AddressOfNames уже отсортирован линкером - тогда сортировка не нужна
+        auto by_name = [&view](UInt32 left, UInt32 right) { return view.NameAt(left) < view.NameAt(right); };
+        if (!std::is_sorted(positions_.begin(), positions_.end(), by_name)) {
+            std::stable_sort(positions_.begin(), positions_.end(), by_name);
+        }
+        
+        return true;
+        
+    } catch (...) {
+        Clear();
+        return false;
+    }
+}
+
+// Очистка упорядоченного массива
+void NameRangeIndex::Clear() noexcept {
+    positions_.clear();
+}
+
+// Диапазон имён с префиксом
+void NameRangeIndex::PrefixRange(std::string_view prefix, const ExportView& view,
+                                 UInt32& first, UInt32& last) const noexcept {
+    auto begin = std::lower_bound(positions_.begin(), positions_.end(), prefix,
+                                  [&view](UInt32 position, std::string_view value) {
+                                      return view.NameAt(position) < value;
+                                  });
+    auto end = std::upper_bound(begin, positions_.end(), prefix,
+                                [&view](std::string_view value, UInt32 position) {
+                                    return value < view.NameAt(position).substr(0, value.size());
+                                });
+    
+    first = static_cast<UInt32>(begin - positions_.begin());
+    last = static_cast<UInt32>(end - positions_.begin());
+}
+
+// Построение полной таблицы экспортов
+bool ExportTable::Build(const ExportDirectory& directory) noexcept {
+    this->directory = directory;
+    
+    if (index.Build(directory) && ordinals.Build(directory, index) &&
+        view.Build(index, ordinals) && addresses.Build(directory, view) && names.Build(view)) {
+        
+        // Без идентификаторов таблица остаётся рабочей, поэтому ошибка не критична
+        SymbolPool& pool = SymbolPool::Instance();
+        if (pool.IsEnabled()) {
+            view.InternNames(pool);
+        }
+        return true;
+    }
+    
+    Clear();
+    return false;
+}
+
+// Очистка полной таблицы экспортов
+void ExportTable::Clear() noexcept {
+    directory = ExportDirectory();
+    index.Clear();
+    ordinals.Clear();
+    view.Clear();
+    addresses.Clear();
+    names.Clear();
+}
+
+// Сравнение поставщиков по текущему правилу
+bool SymbolNamespace::Precedes(const Provider& left, const Provider& right) const noexcept {
+    switch (precedence_) {
+        case SymbolPrecedence::LastAdded:
+            return left.sequence > right.sequence;
+        case SymbolPrecedence::Priority:
+            if (left.priority != right.priority) {
+                return left.priority > right.priority;
+            }
+            return left.sequence < right.sequence;
+        default:
+            return left.sequence < right.sequence;
+    }
+}
+
+// Добавление имён модуля
+bool SymbolNamespace::Add(const void* owner, int priority, const ExportView& view) noexcept {
+    UInt64 sequence = next_sequence_++;
+    UInt32 added = 0;
+    
+    try {
+        names_.reserve(names_.size() + view.NamedCount());
+        
+        for (; added < view.NamedCount(); ++added) {
+            std::string_view name = view.NameAt(added);
+            Key key{name, SymbolHash::HashFast(name.data(), name.size())};
+            Provider provider{owner, priority, sequence, added, name};
+            
+            auto& providers = names_[key];
+            auto it = std::upper_bound(providers.begin(), providers.end(), provider,
+                                       [this](const Provider& left, const Provider& right) {
+                                           return Precedes(left, right);
+                                       });
+            providers.insert(it, provider);
+        }
+        
+        return true;
+        
+    } catch (...) {
+        // Откат уже добавленных имён и того, на котором случилась ошибка:
+        // names_[key] мог успеть создать пустой список с ключом в этот образ
+        for (UInt32 position = 0; position <= added && position < view.NamedCount(); ++position) {
+            std::string_view name = view.NameAt(position);
+            auto it = names_.find(Key{name, SymbolHash::HashFast(name.data(), name.size())});
+            if (it == names_.end()) {
+                continue;
+            }
+            
+            auto& providers = it->second;
+            providers.erase(std::remove_if(providers.begin(), providers.end(),
+                                           [owner](const Provider& provider) { return provider.owner == owner; }),
+                            providers.end());
+            if (providers.empty()) {
+                names_.erase(it);
+            }
+        }
+        return false;
+    }
+}
+
+// Удаление имён модуля
+void SymbolNamespace::Remove(const void* owner, const ExportView& view) noexcept {
+    for (UInt32 position = 0; position < view.NamedCount(); ++position) {
+        std::string_view name = view.NameAt(position);
+        auto it = names_.find(Key{name, SymbolHash::HashFast(name.data(), name.size())});
+        if (it == names_.end()) {
+            continue;
+        }
+        
+        auto& providers = it->second;
+        providers.erase(std::remove_if(providers.begin(), providers.end(),
+                                       [owner](const Provider& provider) { return provider.owner == owner; }),
+                        providers.end());
+        
+        if (providers.empty()) {
+            names_.erase(it);
+        } else if (it->first.name.data() != providers.front().name.data()) {
+            // Ключ мог указывать в образ удаляемого модуля - переносим его
+            // на имя оставшегося поставщика (узел переиспользуется, без аллокаций)
+            auto node = names_.extract(it);
+            node.key().name = node.mapped().front().name;
+            names_.insert(std::move(node));
+        }
+    }
+}
+
+// Очистка пространства имён
+void SymbolNamespace::Clear() noexcept {
+    names_.clear();
+}
+
+// Смена правила выбора поставщика
+void SymbolNamespace::SetPrecedence(SymbolPrecedence precedence) noexcept {
+    precedence_ = precedence;
+    
+    for (auto& [key, providers] : names_) {
+        std::stable_sort(providers.begin(), providers.end(),
+                         [this](const Provider& left, const Provider& right) {
+                             return Precedes(left, right);
+                         });
+    }
+}
+
+// Поиск поставщика имени
+const SymbolNamespace::Provider* SymbolNamespace::Find(const SymbolKey& key) const noexcept {
+    size_t count = 0;
+    const Provider* providers = FindAll(key, count);
+    return count != 0 ? providers : nullptr;
+}
+
+const SymbolNamespace::Provider* SymbolNamespace::Find(std::string_view name) const noexcept {
+    SymbolKey key(name.data(), 0);
+    key.length = static_cast<UInt32>(name.size());
+    key.hash = SymbolHash::HashFast(name.data(), name.size());
+    return Find(key);
+}
+
+// Все поставщики имени
+const SymbolNamespace::Provider* SymbolNamespace::FindAll(const SymbolKey& key, size_t& count) const noexcept {
+    count = 0;
+    if (!key.name) {
+        return nullptr;
+    }
+    
+    auto it = names_.find(Key{std::string_view(key.name, key.length), key.hash});
+    if (it == names_.end() || it->second.empty()) {
+        return nullptr;
+    }
+    
+    count = it->second.size();
+    return it->second.data();
+}
+
+} // namespace MemoryModule
@@ -0,0 +1,744 @@
+/**
+ * @file xMemModExports.h
+ * @brief MemoryModule - Платформонезависимый индекс экспортов PE-образа
+ * @details Разбор IMAGE_EXPORT_DIRECTORY поверх отображённого образа и
+ *          хеш-индекс имён с открытой адресацией. Не зависит от Windows SDK,
+ *          поэтому собирается и тестируется на Linux на синтетических образах.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include "xMemModTypes.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <shared_mutex>
+#include <unordered_map>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MemoryModule {
+
+// Хеширование имён символов: CRC32C с финальным перемешиванием (fmix32).
+// Функции constexpr, поэтому один и тот же хеш можно получить и во время
+// компиляции, и при построении индекса.
+namespace SymbolHash {
+    namespace Detail {
+        constexpr UInt32 kCrc32cPolynomial = 0x82F63B78u;
+
+        struct Crc32cTable {
+            UInt32 values[256];
+        };
+
+        constexpr Crc32cTable MakeCrc32cTable() noexcept {
+            Crc32cTable table{};
+            for (UInt32 i = 0; i < 256; ++i) {
+                UInt32 crc = i;
+                for (int bit = 0; bit < 8; ++bit) {
+                    crc = (crc & 1) ? (crc >> 1) ^ kCrc32cPolynomial : (crc >> 1);
+                }
+                table.values[i] = crc;
+            }
+            return table;
+        }
+
+        inline constexpr Crc32cTable kCrc32cTable = MakeCrc32cTable();
+
+        constexpr UInt32 Mix(UInt32 hash) noexcept {
+            hash ^= hash >> 16;
+            hash *= 0x85EBCA6Bu;
+            hash ^= hash >> 13;
+            hash *= 0xC2B2AE35u;
+            hash ^= hash >> 16;
+            return hash;
+        }
+    }
+
+    // Длина C-строки (constexpr-аналог strlen)
+    constexpr size_t Length(const char* name) noexcept {
+        size_t length = 0;
+        while (name[length] != '\0') {
+            ++length;
+        }
+        return length;
+    }
+
+    // Хеш имени известной длины (constexpr, побайтово по таблице)
+    constexpr UInt32 Hash(const char* name, size_t length) noexcept {
+        UInt32 crc = 0xFFFFFFFFu;
+        for (size_t i = 0; i < length; ++i) {
+            crc = Detail::kCrc32cTable.values[(crc ^ static_cast<UInt8>(name[i])) & 0xFF] ^ (crc >> 8);
+        }
+        return Detail::Mix(~crc);
+    }
+
+    // Тот же хеш во время выполнения: инструкция crc32 (SSE4.2) по 8 байт,
+    // если процессор её поддерживает, иначе Hash()
+    UInt32 HashFast(const char* name, size_t length) noexcept;
+}
+
+// Ключ символа: имя, длина и хеш, вычисленные заранее (обычно при компиляции).
+// Хеш тот же, что использует ExportIndex, поэтому поиск по ключу не считает
+// ни хеш, ни strlen - полная строка сравнивается только для подтверждения.
+struct SymbolKey {
+    const char* name;
+    UInt32 length;
+    UInt32 hash;
+
+    constexpr SymbolKey(const char* symbol_name, size_t symbol_length) noexcept
+        : name(symbol_name)
+        , length(static_cast<UInt32>(symbol_length))
+        , hash(SymbolHash::Hash(symbol_name, symbol_length)) {}
+
+    constexpr explicit SymbolKey(const char* symbol_name) noexcept
+        : SymbolKey(symbol_name, SymbolHash::Length(symbol_name)) {}
+};
+
+// Литерал "Init"_sym; для гарантированного расчёта при компиляции
+// объявляйте ключ как constexpr: static constexpr auto kInit = "Init"_sym;
+namespace SymbolLiterals {
+    constexpr SymbolKey operator""_sym(const char* name, size_t length) noexcept {
+        return SymbolKey(name, length);
+    }
+}
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+    #define XMEMMOD_HAS_SYMBOL_NAME_TEMPLATES 1
+
+// Имя символа как параметр шаблона (C++20): module.GetProc<"Init">()
+template <size_t N>
+struct SymbolName {
+    char value[N];
+
+    constexpr SymbolName(const char (&name)[N]) noexcept : value{} {
+        for (size_t i = 0; i < N; ++i) {
+            value[i] = name[i];
+        }
+    }
+
+    constexpr SymbolKey Key() const noexcept { return SymbolKey(value, N - 1); }
+};
+#endif
+
+// Описание функции интерфейса для BindTable: ключ имени, член-указатель
+// на функцию и признак необязательности. Интерфейс перечисляет их в
+// static constexpr auto Bindings() { return std::make_tuple(...); }
+template <typename Api, typename Function>
+struct SymbolBinding {
+    static_assert(std::is_pointer_v<Function> && std::is_function_v<std::remove_pointer_t<Function>>,
+                  "SymbolBinding member must be a function pointer");
+
+    SymbolKey key;
+    Function Api::* member;
+    bool optional;
+};
+
+// Обязательная функция: её отсутствие попадает в BindResult::missing
+template <typename Api, typename Function>
+constexpr SymbolBinding<Api, Function> BindRequired(const char* name, Function Api::* member) noexcept {
+    return SymbolBinding<Api, Function>{SymbolKey(name), member, false};
+}
+
+// Необязательная функция: при отсутствии остаётся nullptr
+template <typename Api, typename Function>
+constexpr SymbolBinding<Api, Function> BindOptional(const char* name, Function Api::* member) noexcept {
+    return SymbolBinding<Api, Function>{SymbolKey(name), member, true};
+}
+
+// Результат привязки интерфейса
+template <typename Api>
+struct BindResult {
+    Api api{};                              // Заполненная таблица функций
+    std::vector<std::string_view> missing;  // Все отсутствующие обязательные имена
+    bool ok = false;                        // Найдены все обязательные функции
+
+    explicit operator bool() const noexcept { return ok; }
+};
+
+namespace Detail {
+    template <typename Tuple, size_t... I>
+    constexpr std::array<SymbolKey, sizeof...(I)> BindingKeys(const Tuple& bindings, std::index_sequence<I...>) noexcept {
+        return {{std::get<I>(bindings).key...}};
+    }
+
+    template <typename Api, typename Function, typename Address>
+    void ApplyBinding(Api& api, const SymbolBinding<Api, Function>& binding, Address address,
+                      std::vector<std::string_view>& missing) {
+        api.*binding.member = reinterpret_cast<Function>(address);
+        if (!address && !binding.optional) {
+            missing.emplace_back(binding.key.name, binding.key.length);
+        }
+    }
+}
+
+// Ключи всех функций интерфейса в порядке Api::Bindings() (хеши - при компиляции)
+template <typename Api>
+constexpr auto BindingKeys() noexcept {
+    constexpr auto bindings = Api::Bindings();
+    return Detail::BindingKeys(bindings, std::make_index_sequence<std::tuple_size_v<decltype(bindings)>>{});
+}
+
+// Заполнение интерфейса найденными адресами (addresses[i] - для BindingKeys()[i])
+template <typename Api, typename Address>
+void ApplyBindings(Api& api, const Address* addresses, std::vector<std::string_view>& missing) {
+    constexpr auto bindings = Api::Bindings();
+    size_t index = 0;
+    std::apply([&](const auto&... binding) {
+        (Detail::ApplyBinding(api, binding, addresses[index++], missing), ...);
+    }, bindings);
+}
+
+// Сырой IMAGE_EXPORT_DIRECTORY (раскладка совпадает с winnt.h)
+struct RawExportDirectory {
+    UInt32 Characteristics;
+    UInt32 TimeDateStamp;
+    UInt16 MajorVersion;
+    UInt16 MinorVersion;
+    UInt32 Name;
+    UInt32 Base;
+    UInt32 NumberOfFunctions;
+    UInt32 NumberOfNames;
+    UInt32 AddressOfFunctions;
+    UInt32 AddressOfNames;
+    UInt32 AddressOfNameOrdinals;
+};
+
+static_assert(sizeof(RawExportDirectory) == 40, "RawExportDirectory must match IMAGE_EXPORT_DIRECTORY");
+
+// Известный порядок таблицы имён (кэшируется вызывающей стороной)
+enum class NameOrder : UInt8 {
+    Unknown,   // Ещё не проверялся
+    Sorted,    // Проверен: лексикографически отсортирован
+    Unsorted   // Проверен: не отсортирован, нужен линейный поиск
+};
+
+// Каталог экспортов внутри отображённого образа.
+// Все массивы проверены на выход за границы образа при чтении.
+struct ExportDirectory {
+    const UInt8* image_base = nullptr;
+    size_t image_size = 0;
+    UInt32 directory_rva = 0;
+    UInt32 directory_size = 0;
+    UInt32 ordinal_base = 0;
+    UInt32 number_of_functions = 0;
+    UInt32 number_of_names = 0;
+    const UInt32* functions = nullptr;      // AddressOfFunctions
+    const UInt32* names = nullptr;          // AddressOfNames
+    const UInt16* name_ordinals = nullptr;  // AddressOfNameOrdinals
+
+    // Чтение каталога по RVA из DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT]
+    static bool Read(const void* image_base, size_t image_size,
+                     UInt32 rva, UInt32 size, ExportDirectory& out) noexcept;
+
+    // Имя по индексу в AddressOfNames (nullptr, если строка выходит за образ)
+    const char* NameAt(UInt32 index, size_t* length = nullptr) const noexcept;
+
+    // Поиск без построения индекса: двоичный поиск по AddressOfNames
+    // (линкер сортирует имена), линейный - только для неотсортированной таблицы.
+    // Возвращает индекс в AddressOfNames или ExportIndex::kNotFound;
+    // order - кэш проверки порядка, обновляется при первой необходимости.
+    UInt32 FindName(const char* name, size_t length, NameOrder& order) const noexcept;
+
+    // Двоичный поиск; order_violation выставляется, если по пути поиска
+    // замечено нарушение порядка (тогда результату доверять нельзя)
+    UInt32 FindNameBinary(const char* name, size_t length, bool* order_violation) const noexcept;
+    UInt32 FindNameLinear(const char* name, size_t length) const noexcept;
+    bool IsNameTableSorted() const noexcept;
+
+    // Индекс функции (ordinal - Base) для имени из AddressOfNames
+    UInt16 FunctionIndexAt(UInt32 index) const noexcept { return name_ordinals[index]; }
+
+    // Форвардер: RVA функции указывает внутрь каталога экспортов, на строку "OTHER.Func"
+    bool IsForwarder(UInt32 rva) const noexcept { return rva - directory_rva < directory_size; }
+    std::string_view ForwarderAt(UInt32 rva) const noexcept;
+};
+
+// Цель форвардера: "MODULE.Func" или "MODULE.#12"
+struct ForwarderTarget {
+    std::string_view module;  // Имя модуля без расширения
+    std::string_view symbol;  // Имя функции (пустое при by_ordinal)
+    UInt32 ordinal;           // Ординал при by_ordinal
+    bool by_ordinal;
+};
+
+// Разбор строки форвардера
+bool ParseForwarder(std::string_view text, ForwarderTarget& target) noexcept;
+
+// Подключаемый резолвер: возвращает итоговый адрес цели (сам раскрывает
+// дальнейшие звенья цепочки, например через GetProcAddress другого модуля)
+using ForwarderResolver = std::function<const void*(const ForwarderTarget& target)>;
+
+// Область кэша форвардеров: у каждого подключённого резолвера своя, чтобы
+// модули с разными резолверами не получали чужих результатов.
+// kDefaultForwarderScope - общая область резолвера по умолчанию.
+using ForwarderScope = UInt64;
+constexpr ForwarderScope kDefaultForwarderScope = 0;
+
+// Общий на процесс кэш разрешённых форвардеров: (область, "MODULE.Func") -> итоговый
+// адрес. Повторное разрешение - одна проба хеш-таблицы под разделяемой блокировкой.
+// Имя модуля сравнивается без учёта регистра, как в загрузчике Windows.
+class ForwarderCache {
+public:
+    static ForwarderCache& Instance() noexcept;
+
+    // Новая уникальная область (никогда не равна kDefaultForwarderScope)
+    static ForwarderScope NewScope() noexcept;
+
+    bool Find(ForwarderScope scope, const ForwarderTarget& target, const void*& address) const noexcept;
+    void Insert(ForwarderScope scope, const ForwarderTarget& target, const void* address) noexcept;
+
+    // Удаление адресов, указывающих в выгружаемый образ
+    void Invalidate(const void* image_base, size_t image_size) noexcept;
+    // Удаление всех результатов области (резолвер сменён или модуль уничтожен)
+    void InvalidateScope(ForwarderScope scope) noexcept;
+    void Clear() noexcept;
+    size_t Size() const noexcept;
+
+private:
+    struct Entry {
+        ForwarderScope scope;
+        std::string module;
+        std::string symbol;
+        UInt32 ordinal;
+        bool by_ordinal;
+        const void* address;
+    };
+
+    static UInt64 KeyOf(ForwarderScope scope, const ForwarderTarget& target) noexcept;
+    static bool Matches(const Entry& entry, ForwarderScope scope, const ForwarderTarget& target) noexcept;
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<UInt64, Entry> entries_;
+};
+
+// Разрешение форвардера через кэш области scope; при промахе вызывает резолвер
+// и запоминает результат. Глубина вложенных разрешений ограничена (защита от циклов).
+const void* ResolveForwarder(std::string_view text, const ForwarderResolver& resolver,
+                             ForwarderScope scope = kDefaultForwarderScope) noexcept;
+
+// Идентификатор интернированного имени символа (0 - нет идентификатора)
+using SymbolId = UInt32;
+constexpr SymbolId kInvalidSymbolId = 0;
+
+// Общий на процесс пул имён символов: каждое различное имя хранится один раз
+// и получает 32-битный идентификатор, поэтому одинаковые имена разных модулей
+// сравниваются как числа. Вставка и поиск без блокировок (CAS в голову цепочки
+// корзины), имена не удаляются до конца процесса. Пул включается явно:
+// после SetEnabled(true) новые таблицы экспортов хранят в ExportView только
+// идентификаторы (ExportView::Ids()) вместо собственного столбца имён.
+class SymbolPool {
+public:
+    static constexpr UInt32 kBucketCount = 1u << 16;
+    static constexpr UInt32 kChunkSize = 1u << 12;
+    static constexpr UInt32 kMaxChunks = 1u << 12;  // До 16M имён
+
+    static SymbolPool& Instance() noexcept;
+
+    void SetEnabled(bool enabled) noexcept { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool IsEnabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+    // Идентификатор имени, при необходимости с добавлением; 0, если пул заполнен
+    SymbolId Intern(const SymbolKey& key) noexcept;
+    SymbolId Intern(std::string_view name) noexcept;
+
+    // Идентификатор без добавления; 0, если имени в пуле нет
+    SymbolId Find(const SymbolKey& key) const noexcept;
+    SymbolId Find(std::string_view name) const noexcept;
+
+    // Имя и ключ по идентификатору (имя завершено нулём и живёт до конца процесса)
+    std::string_view Name(SymbolId id) const noexcept;
+    SymbolKey Key(SymbolId id) const noexcept;
+
+    // Число различных имён
+    size_t Size() const noexcept { return count_.load(std::memory_order_relaxed); }
+
+    SymbolPool(const SymbolPool&) = delete;
+    SymbolPool& operator=(const SymbolPool&) = delete;
+
+private:
+    struct Node {
+        std::atomic<Node*> next;
+        UInt32 hash;
+        UInt32 length;
+        SymbolId id;
+        char name[1];
+    };
+
+    SymbolPool() noexcept = default;
+    ~SymbolPool();
+
+    static const Node* FindInChain(const Node* node, const Node* stop, const SymbolKey& key) noexcept;
+    const Node* NodeAt(SymbolId id) const noexcept;
+
+    std::atomic<Node*> buckets_[kBucketCount] = {};
+    std::atomic<std::atomic<Node*>*> chunks_[kMaxChunks] = {};
+    std::atomic<UInt32> next_id_{1};
+    std::atomic<size_t> count_{0};
+    std::atomic<bool> enabled_{false};
+};
+
+// Хеш-индекс имён экспортов (открытая адресация, линейное пробирование).
+// Строится один раз и далее только читается: поиск без аллокаций и копий.
+class ExportIndex {
+public:
+    static constexpr UInt32 kNotFound = 0xFFFFFFFFu;
+
+    // Начиная с этого числа имён построение автоматически идёт в несколько потоков
+    static constexpr UInt32 kParallelThreshold = 8192;
+
+    // Построение индекса; слоты нумеруются в порядке AddressOfNames,
+    // некорректные записи (имя вне образа, ординал вне таблицы) пропускаются.
+    // max_workers: 0 - автоматически (потоки только выше kParallelThreshold),
+    // 1 - последовательно, N - не больше N потоков.
+    bool Build(const ExportDirectory& directory, UInt32 max_workers = 0) noexcept;
+    void Clear() noexcept;
+
+    // Поиск имени; возвращает слот экспорта или kNotFound
+    UInt32 Find(const char* name) const noexcept;
+    UInt32 Find(const char* name, size_t length, UInt32 hash) const noexcept;
+    UInt32 Find(const SymbolKey& key) const noexcept { return Find(key.name, key.length, key.hash); }
+
+    // Пакетный поиск: хеши считаются группами, ячейки таблицы подтягиваются
+    // в кэш до пробирования. slots[i] = слот или kNotFound для каждого имени.
+    void FindMany(const char* const* names, UInt32* slots, size_t count) const noexcept;
+    void FindMany(const SymbolKey* keys, UInt32* slots, size_t count) const noexcept;
+
+    // Доступ к слотам
+    UInt32 Size() const noexcept { return static_cast<UInt32>(entries_.size()); }
+    bool Empty() const noexcept { return entries_.empty(); }
+    const char* NameAt(UInt32 slot) const noexcept { return entries_[slot].name; }
+    UInt32 NameLengthAt(UInt32 slot) const noexcept { return entries_[slot].length; }
+    UInt16 FunctionIndexAt(UInt32 slot) const noexcept { return entries_[slot].function_index; }
+
+private:
+    // Ячейка хеш-таблицы: полный хеш служит тегом для быстрого отсева
+    struct Slot {
+        UInt32 hash;
+        UInt32 entry;  // слот экспорта + 1, 0 - пустая ячейка
+    };
+
+    struct Entry {
+        const char* name;
+        UInt32 length;
+        UInt16 function_index;
+    };
+
+    bool Insert(UInt32 slot, UInt32 hash) noexcept;
+
+    std::vector<Slot> slots_;
+    std::vector<Entry> entries_;
+    UInt32 mask_ = 0;
+};
+
+// Ячейка таблицы ординалов: всё, что нужно для ответа, в одном блоке
+struct OrdinalEntry {
+    const void* address;  // Готовый адрес (image_base + rva)
+    const char* name;     // Имя или nullptr для экспорта только по ординалу
+    UInt32 rva;           // RVA функции (0 - пустая ячейка)
+    UInt32 name_length;   // Длина имени
+};
+
+// Плотная таблица ординалов: индекс = ordinal - Base, размер = NumberOfFunctions.
+// Покрывает и экспорты без имени; поиск - одна проверка границ и чтение ячейки.
+class OrdinalTable {
+public:
+    // Построение по каталогу; имена берутся из уже построенного индекса имён
+    bool Build(const ExportDirectory& directory, const ExportIndex& index) noexcept;
+    void Clear() noexcept;
+
+    // Поиск по ординалу; nullptr, если ординала нет в таблице
+    const OrdinalEntry* Find(UInt32 ordinal) const noexcept {
+        UInt32 position = ordinal - base_;
+        if (position >= entries_.size() || entries_[position].rva == 0) {
+            return nullptr;
+        }
+        return &entries_[position];
+    }
+
+    UInt32 Base() const noexcept { return base_; }
+    UInt32 Size() const noexcept { return static_cast<UInt32>(entries_.size()); }
+    const OrdinalEntry& At(UInt32 position) const noexcept { return entries_[position]; }
+
+private:
+    std::vector<OrdinalEntry> entries_;
+    UInt32 base_ = 0;
+};
+
+// Неизменяемое представление всех экспортов в виде параллельных массивов.
+// Имена - std::string_view прямо в таблицу имён отображённого образа, а после
+// InternNames - в SymbolPool (столбец имён заменяется 32-битными идентификаторами),
+// поэтому перечисление не выделяет память. Порядок: сначала именованные
+// экспорты в порядке слотов ExportIndex, затем экспорты только по ординалу.
+class ExportView {
+public:
+    // Одна запись представления (собирается из столбцов по месту)
+    struct Entry {
+        UInt32 ordinal;
+        UInt32 rva;
+        const void* address;
+        std::string_view name;
+        SymbolId id;  // kInvalidSymbolId, если имена не интернированы
+    };
+
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Entry;
+
+        Iterator() noexcept = default;
+        Iterator(const ExportView* view, UInt32 position) noexcept : view_(view), position_(position) {}
+
+        Entry operator*() const noexcept { return (*view_)[position_]; }
+        Entry operator[](difference_type offset) const noexcept { return (*view_)[position_ + static_cast<UInt32>(offset)]; }
+        Iterator& operator++() noexcept { ++position_; return *this; }
+        Iterator operator++(int) noexcept { Iterator copy = *this; ++position_; return copy; }
+        Iterator& operator--() noexcept { --position_; return *this; }
+        Iterator operator--(int) noexcept { Iterator copy = *this; --position_; return copy; }
+        Iterator& operator+=(difference_type offset) noexcept { position_ += static_cast<UInt32>(offset); return *this; }
+        Iterator& operator-=(difference_type offset) noexcept { position_ -= static_cast<UInt32>(offset); return *this; }
+        Iterator operator+(difference_type offset) const noexcept { Iterator copy = *this; return copy += offset; }
+        Iterator operator-(difference_type offset) const noexcept { Iterator copy = *this; return copy -= offset; }
+        difference_type operator-(const Iterator& other) const noexcept {
+            return static_cast<difference_type>(position_) - static_cast<difference_type>(other.position_);
+        }
+        bool operator==(const Iterator& other) const noexcept { return position_ == other.position_; }
+        bool operator!=(const Iterator& other) const noexcept { return position_ != other.position_; }
+        bool operator<(const Iterator& other) const noexcept { return position_ < other.position_; }
+
+    private:
+        const ExportView* view_ = nullptr;
+        UInt32 position_ = 0;
+    };
+
+    // Построение столбцов по уже готовым индексу имён и таблице ординалов
+    bool Build(const ExportIndex& index, const OrdinalTable& ordinals) noexcept;
+    void Clear() noexcept;
+
+    // Замена столбца имён идентификаторами из пула; при ошибке представление
+    // не меняется
+    bool InternNames(SymbolPool& pool) noexcept;
+
+    // Размеры
+    UInt32 Size() const noexcept { return static_cast<UInt32>(ordinals_.size()); }
+    bool Empty() const noexcept { return ordinals_.empty(); }
+    UInt32 NamedCount() const noexcept { return named_count_; }
+
+    // Доступ к записям
+    Entry operator[](UInt32 position) const noexcept {
+        return Entry{ordinals_[position], rvas_[position], addresses_[position], NameAt(position),
+                     ids_.empty() ? kInvalidSymbolId : ids_[position]};
+    }
+
+    // Имя по позиции: из образа или, после InternNames, из пула
+    std::string_view NameAt(UInt32 position) const noexcept {
+        return pool_ ? pool_->Name(ids_[position]) : names_[position];
+    }
+    Iterator begin() const noexcept { return Iterator(this, 0); }
+    Iterator end() const noexcept { return Iterator(this, Size()); }
+
+    // Столбцы целиком
+    const UInt32* Ordinals() const noexcept { return ordinals_.data(); }
+    const UInt32* Rvas() const noexcept { return rvas_.data(); }
+    const void* const* Addresses() const noexcept { return addresses_.data(); }
+    const SymbolId* Ids() const noexcept { return ids_.empty() ? nullptr : ids_.data(); }
+
+private:
+    std::vector<UInt32> ordinals_;
+    std::vector<UInt32> rvas_;
+    std::vector<const void*> addresses_;
+    std::vector<std::string_view> names_;  // Пуст после InternNames
+    std::vector<SymbolId> ids_;
+    const SymbolPool* pool_ = nullptr;
+    UInt32 named_count_ = 0;
+};
+
+// Результат обратного поиска: экспорт, содержащий адрес
+struct ExportSymbol {
+    UInt32 position;       // Позиция в ExportView
+    UInt32 ordinal;        // Ординал экспорта
+    UInt32 rva;            // RVA начала экспорта
+    UInt32 offset;         // Смещение искомого адреса от начала экспорта
+    UInt32 size;           // Оценка размера: до следующего экспорта или конца образа
+    const void* address;   // Начало экспорта
+    std::string_view name; // Имя (пустое для экспорта только по ординалу)
+};
+
+// Массив экспортов, отсортированный по RVA, для поиска адрес -> экспорт.
+// Дубликаты RVA схлопываются (предпочтение именованному), форвардеры
+// (RVA внутри каталога экспортов - это строки, а не код) и записи с RVA 0
+// не включаются.
+class AddressIndex {
+public:
+    bool Build(const ExportDirectory& directory, const ExportView& view) noexcept;
+    void Clear() noexcept;
+
+    // Ближайший экспорт с RVA <= rva; false, если адрес раньше первого экспорта
+    bool Find(UInt32 rva, const ExportView& view, ExportSymbol& symbol) const noexcept;
+
+    UInt32 Size() const noexcept { return static_cast<UInt32>(entries_.size()); }
+
+private:
+    struct Entry {
+        UInt32 rva;
+        UInt32 position;
+    };
+
+    std::vector<Entry> entries_;
+    UInt32 image_size_ = 0;
+};
+
+// Сопоставление имени с шаблоном: '*' - любая подстрока, '?' - один символ
+bool MatchSymbolPattern(std::string_view pattern, std::string_view name) noexcept;
+
+// Именованные экспорты, упорядоченные по имени, для перечисления по префиксу
+// или шаблону. Хранит только позиции в ExportView - строки остаются в образе.
+// Запрос: двоичный поиск диапазона по префиксу + проход по совпадениям.
+class NameRangeIndex {
+public:
+    bool Build(const ExportView& view) noexcept;
+    void Clear() noexcept;
+
+    // Диапазон [first, last) позиций в упорядоченном массиве с данным префиксом
+    void PrefixRange(std::string_view prefix, const ExportView& view, UInt32& first, UInt32& last) const noexcept;
+    UInt32 PositionAt(UInt32 index) const noexcept { return positions_[index]; }
+
+    // Обход экспортов по шаблону. Без '*' и '?' шаблон считается префиксом
+    // ("Plugin_" == "Plugin_*"). callback(const ExportView::Entry&) может
+    // вернуть false, чтобы остановить обход. Возвращает число совпадений.
+    template <typename Callback>
+    size_t ForEachMatch(std::string_view pattern, const ExportView& view, Callback&& callback) const {
+        size_t wildcard = pattern.find_first_of("*?");
+        std::string_view prefix = pattern.substr(0, wildcard);
+        
+        UInt32 first = 0;
+        UInt32 last = 0;
+        PrefixRange(prefix, view, first, last);
+        
+        size_t matches = 0;
+        for (UInt32 i = first; i < last; ++i) {
+            ExportView::Entry entry = view[positions_[i]];
+            if (wildcard != std::string_view::npos && !MatchSymbolPattern(pattern, entry.name)) {
+                continue;
+            }
+            
+            ++matches;
+            if constexpr (std::is_void_v<decltype(callback(entry))>) {
+                callback(entry);
+            } else if (!callback(entry)) {
+                break;
+            }
+        }
+        
+        return matches;
+    }
+
+private:
+    std::vector<UInt32> positions_;
+};
+
+// Полная таблица экспортов модуля: индекс имён, таблица ординалов,
+// представление, индекс адресов и упорядоченные имена (и идентификаторы
+// имён, если включён SymbolPool). Строится один раз и далее только читается, поэтому её
+// публикуют через атомарный указатель и читают без блокировок.
+struct ExportTable {
+    ExportDirectory directory;
+    ExportIndex index;
+    OrdinalTable ordinals;
+    ExportView view;
+    AddressIndex addresses;
+    NameRangeIndex names;
+
+    // Построение всех частей; при ошибке таблица остаётся пустой
+    bool Build(const ExportDirectory& directory) noexcept;
+    void Clear() noexcept;
+
+    // Адрес и ординал по слоту индекса имён (слот = позиция в view)
+    const void* AddressAt(UInt32 slot) const noexcept { return view.Addresses()[slot]; }
+    UInt32 OrdinalAt(UInt32 slot) const noexcept { return view.Ordinals()[slot]; }
+    UInt32 RvaAt(UInt32 slot) const noexcept { return view.Rvas()[slot]; }
+
+    // Адреса форвардеров в view указывают на строку цели, а не на код
+    bool IsForwarder(UInt32 rva) const noexcept { return directory.IsForwarder(rva); }
+};
+
+// Правило выбора поставщика, если имя экспортируют несколько модулей
+enum class SymbolPrecedence : UInt8 {
+    FirstAdded,  // Побеждает модуль, добавленный раньше
+    LastAdded,   // Побеждает модуль, добавленный позже (переопределение)
+    Priority     // Побеждает больший приоритет, при равенстве - раньше добавленный
+};
+
+// Общее пространство имён нескольких модулей: имя -> упорядоченный по правилу
+// список поставщиков (владелец, позиция в его ExportView). Поиск - одна проба
+// хеш-таблицы; добавление и удаление модуля затрагивают только его имена.
+// Имена - string_view в образы модулей; синхронизация - на стороне владельца.
+class SymbolNamespace {
+public:
+    struct Provider {
+        const void* owner;      // Модуль (непрозрачный для пространства имён)
+        int priority;
+        UInt64 sequence;        // Порядок добавления
+        UInt32 position;        // Позиция в ExportView модуля
+        std::string_view name;  // Имя в образе этого модуля
+    };
+
+    explicit SymbolNamespace(SymbolPrecedence precedence = SymbolPrecedence::FirstAdded) noexcept
+        : precedence_(precedence) {}
+
+    // Добавление всех именованных экспортов модуля; при ошибке ничего не меняется
+    bool Add(const void* owner, int priority, const ExportView& view) noexcept;
+
+    // Удаление всех имён модуля (view - то же представление, что при Add)
+    void Remove(const void* owner, const ExportView& view) noexcept;
+    void Clear() noexcept;
+
+    // Смена правила с пересортировкой списков поставщиков
+    void SetPrecedence(SymbolPrecedence precedence) noexcept;
+    SymbolPrecedence Precedence() const noexcept { return precedence_; }
+
+    // Победивший поставщик имени; nullptr, если имени нет
+    const Provider* Find(const SymbolKey& key) const noexcept;
+    const Provider* Find(std::string_view name) const noexcept;
+
+    // Все поставщики имени в порядке правила (count - их число)
+    const Provider* FindAll(const SymbolKey& key, size_t& count) const noexcept;
+
+    // Число различных имён
+    size_t Size() const noexcept { return names_.size(); }
+
+private:
+    // Ключ с заранее посчитанным хешем: таблица не хеширует строки повторно
+    struct Key {
+        std::string_view name;
+        UInt32 hash;
+
+        bool operator==(const Key& other) const noexcept { return name == other.name; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept { return key.hash; }
+    };
+
+    bool Precedes(const Provider& left, const Provider& right) const noexcept;
+
+    std::unordered_map<Key, std::vector<Provider>, KeyHash> names_;
+    SymbolPrecedence precedence_;
+    UInt64 next_sequence_ = 0;
+};
+
+} // namespace MemoryModule
@@ -0,0 +1,187 @@
+﻿/**
+ * @file xMemModImage.cpp
+ * @brief MemoryModule - Реализация разбора заголовков PE
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModImage.h"
+
+#include <cstring>
+
+namespace MemoryModule {
+
+namespace {
+    // Смещения полей (winnt.h)
+    constexpr UInt16 kDosSignature = 0x5A4D;          // "MZ"
+    constexpr UInt32 kNtSignature = 0x00004550;       // "PE\0\0"
+    constexpr UInt16 kOptionalMagic32 = 0x10B;
+    constexpr UInt16 kOptionalMagic64 = 0x20B;
+    constexpr size_t kDosLfanewOffset = 0x3C;
+    constexpr size_t kFileHeaderSize = 20;
+    constexpr size_t kSectionHeaderSize = 40;
+    
+    template <typename T>
+    bool ReadAt(const UInt8* data, size_t size, size_t offset, T& value) noexcept {
+        if (offset > size || size - offset < sizeof(T)) {
+            return false;
+        }
+        memcpy(&value, data + offset, sizeof(T));
+        return true;
+    }
+}
+
+// Разбор заголовков
+bool ImageLayout::Parse(const void* data, size_t size, ImageLayout& out) noexcept {
+    try {
+        out = ImageLayout();
+        
+        const auto* bytes = static_cast<const UInt8*>(data);
+        if (!bytes) {
+            return false;
+        }
+        
+        UInt16 dos_signature = 0;
+        UInt32 lfanew = 0;
+        UInt32 nt_signature = 0;
+        if (!ReadAt(bytes, size, 0, dos_signature) || dos_signature != kDosSignature ||
+            !ReadAt(bytes, size, kDosLfanewOffset, lfanew) ||
+            !ReadAt(bytes, size, lfanew, nt_signature) || nt_signature != kNtSignature) {
+            return false;
+        }
+        
+        // IMAGE_FILE_HEADER
+        size_t file_header = static_cast<size_t>(lfanew) + 4;
+        UInt16 number_of_sections = 0;
+        UInt16 optional_size = 0;
+        if (!ReadAt(bytes, size, file_header + 0, out.machine) ||
+            !ReadAt(bytes, size, file_header + 2, number_of_sections) ||
+            !ReadAt(bytes, size, file_header + 4, out.time_date_stamp) ||
+            !ReadAt(bytes, size, file_header + 16, optional_size) ||
+            !ReadAt(bytes, size, file_header + 18, out.characteristics)) {
+            return false;
+        }
+        
+        // IMAGE_OPTIONAL_HEADER32/64: общие поля совпадают по смещениям,
+        // кроме ImageBase и начала каталогов данных
+        size_t optional = file_header + kFileHeaderSize;
+        UInt16 magic = 0;
+        if (!ReadAt(bytes, size, optional, magic)) {
+            return false;
+        }
+        
+        size_t directories_offset = 0;
+        size_t count_offset = 0;
+        if (magic == kOptionalMagic64) {
+            out.is_64bit = true;
+            if (!ReadAt(bytes, size, optional + 24, out.image_base)) {
+                return false;
+            }
+            count_offset = 108;
+            directories_offset = 112;
+        } else if (magic == kOptionalMagic32) {
+            UInt32 image_base = 0;
+            if (!ReadAt(bytes, size, optional + 28, image_base)) {
+                return false;
+            }
+            out.image_base = image_base;
+            count_offset = 92;
+            directories_offset = 96;
+        } else {
+            return false;
+        }
+        
+        UInt32 directory_count = 0;
+        if (!ReadAt(bytes, size, optional + 16, out.entry_point) ||
+            !ReadAt(bytes, size, optional + 32, out.section_alignment) ||
+            !ReadAt(bytes, size, optional + 36, out.file_alignment) ||
+            !ReadAt(bytes, size, optional + 56, out.size_of_image) ||
+            !ReadAt(bytes, size, optional + 60, out.size_of_headers) ||
+            !ReadAt(bytes, size, optional + 64, out.checksum) ||
+            !ReadAt(bytes, size, optional + count_offset, directory_count)) {
+            return false;
+        }
+        
+        if (directory_count > ImageDirectory::kCount) {
+            directory_count = ImageDirectory::kCount;
+        }
+        if (directories_offset + directory_count * sizeof(ImageDataDirectory) > optional_size) {
+            return false;
+        }
+        
+        for (UInt32 i = 0; i < directory_count; ++i) {
+            if (!ReadAt(bytes, size, optional + directories_offset + i * sizeof(ImageDataDirectory),
+                        out.directories[i])) {
+                return false;
+            }
+        }
+        
+        // Таблица секций
+        size_t section_table = optional + optional_size;
+        out.sections.resize(number_of_sections);
+        
+        for (UInt16 i = 0; i < number_of_sections; ++i) {
+            size_t header = section_table + i * kSectionHeaderSize;
+            ImageSection& section = out.sections[i];
+            
+            if (header > size || size - header < kSectionHeaderSize) {
+                return false;
+            }
+            
+            memcpy(section.name, bytes + header, sizeof(section.name));
+            ReadAt(bytes, size, header + 8, section.virtual_size);
+            ReadAt(bytes, size, header + 12, section.virtual_address);
+            ReadAt(bytes, size, header + 16, section.raw_size);
+            ReadAt(bytes, size, header + 20, section.raw_offset);
+            ReadAt(bytes, size, header + 36, section.characteristics);
+        }
+        
+        return out.size_of_image != 0 && out.size_of_headers <= out.size_of_image;
+        
+    } catch (...) {
+        out = ImageLayout();
+        return false;
+    }
+}
+
+// Раскладка файла по RVA
+bool ImageLayout::Map(const void* data, size_t size, std::vector<UInt8>& image) const noexcept {
+    try {
+        image.assign(size_of_image, 0);
+        
+        const auto* bytes = static_cast<const UInt8*>(data);
+        size_t headers = size_of_headers < size ? size_of_headers : size;
+        memcpy(image.data(), bytes, headers);
+        
+        for (const ImageSection& section : sections) {
+            // Как и загрузчик: копируется не больше VirtualSize (если он задан)
+            UInt32 length = section.raw_size;
+            if (section.virtual_size != 0 && section.virtual_size < length) {
+                length = section.virtual_size;
+            }
+            if (length == 0) {
+                continue;
+            }
+            
+            if (static_cast<UInt64>(section.raw_offset) + length > size ||
+                static_cast<UInt64>(section.virtual_address) + length > size_of_image) {
+                image.clear();
+                return false;
+            }
+            
+            memcpy(image.data() + section.virtual_address, bytes + section.raw_offset, length);
+        }
+        
+        return true;
+        
+    } catch (...) {
+        image.clear();
+        return false;
+    }
+}
+
+} // namespace MemoryModule
@@ -0,0 +1,73 @@
+/**
+ * @file xMemModImage.h
+ * @brief MemoryModule - Платформонезависимый разбор заголовков PE
+ * @details Чтение DOS/NT-заголовков и таблицы секций из байтового буфера
+ *          (PE32 и PE32+) и раскладка файла по RVA, как это делает загрузчик.
+ *          Не зависит от Windows SDK: используется офлайн-инструментами
+ *          (xMemModBindgen) и собирается на Linux.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include "xMemModTypes.h"
+
+#include <vector>
+
+namespace MemoryModule {
+
+// Индексы каталогов данных (как IMAGE_DIRECTORY_ENTRY_*)
+namespace ImageDirectory {
+    constexpr UInt32 kExport = 0;
+    constexpr UInt32 kImport = 1;
+    constexpr UInt32 kBaseReloc = 5;
+    constexpr UInt32 kTls = 9;
+    constexpr UInt32 kCount = 16;
+}
+
+// Каталог данных
+struct ImageDataDirectory {
+    UInt32 rva;
+    UInt32 size;
+};
+
+// Секция
+struct ImageSection {
+    char name[8];
+    UInt32 virtual_address;
+    UInt32 virtual_size;
+    UInt32 raw_offset;
+    UInt32 raw_size;
+    UInt32 characteristics;
+};
+
+// Разобранные заголовки PE (только поля, нужные библиотеке)
+struct ImageLayout {
+    bool is_64bit = false;
+    UInt16 machine = 0;
+    UInt16 characteristics = 0;
+    UInt32 time_date_stamp = 0;
+    UInt64 image_base = 0;
+    UInt32 entry_point = 0;
+    UInt32 section_alignment = 0;
+    UInt32 file_alignment = 0;
+    UInt32 size_of_image = 0;
+    UInt32 size_of_headers = 0;
+    UInt32 checksum = 0;
+    ImageDataDirectory directories[ImageDirectory::kCount] = {};
+    std::vector<ImageSection> sections;
+
+    // Разбор заголовков файла; все смещения проверяются на границы буфера
+    static bool Parse(const void* data, size_t size, ImageLayout& out) noexcept;
+
+    // Раскладка файла по RVA в буфер SizeOfImage (заголовки + секции,
+    // хвосты секций обнуляются) - без релокаций, импортов и защиты страниц
+    bool Map(const void* data, size_t size, std::vector<UInt8>& image) const noexcept;
+};
+
+} // namespace MemoryModule
@@ -0,0 +1,275 @@
+﻿/**
+ * @file xMemModIndexFile.cpp
+ * @brief MemoryModule - Реализация сохраняемого индекса экспортов
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModIndexFile.h"
+
+#include <cstring>
+
+namespace MemoryModule {
+
+namespace {
+    // Массив count элементов по смещению offset целиком внутри файла и выровнен
+    template <typename T>
+    bool IsArrayInFile(UInt32 offset, UInt32 count, size_t file_size) noexcept {
+        UInt64 end = static_cast<UInt64>(offset) + static_cast<UInt64>(count) * sizeof(T);
+        return offset % alignof(T) == 0 && end <= file_size;
+    }
+}
+
+// Ключ содержимого образа
+UInt64 ExportIndexKey(const ExportDirectory& directory, const ImageFingerprint& fingerprint) noexcept {
+    UInt32 content = 0;
+    if (directory.image_base && static_cast<UInt64>(directory.directory_rva) + directory.directory_size <= directory.image_size) {
+        content = SymbolHash::HashFast(reinterpret_cast<const char*>(directory.image_base) + directory.directory_rva,
+                                       directory.directory_size);
+    }
+    
+    UInt32 fields[] = {
+        fingerprint.image_size, fingerprint.time_date_stamp, fingerprint.checksum,
+        directory.directory_rva, directory.directory_size, directory.ordinal_base,
+        directory.number_of_functions, directory.number_of_names
+    };
+    UInt32 layout = SymbolHash::HashFast(reinterpret_cast<const char*>(fields), sizeof(fields));
+    
+    return (static_cast<UInt64>(content) << 32) | layout;
+}
+
+// Генерация файла индекса
+bool BuildExportIndexFile(const ExportDirectory& directory, const ImageFingerprint& fingerprint,
+                          std::vector<UInt8>& out) noexcept {
+    try {
+        out.clear();
+        
+        // Записи - в порядке AddressOfNames, некорректные пропускаются (как в ExportIndex)
+        std::vector<IndexFile::Entry> entries;
+        std::vector<UInt32> hashes;
+        entries.reserve(directory.number_of_names);
+        hashes.reserve(directory.number_of_names);
+        
+        for (UInt32 i = 0; i < directory.number_of_names; ++i) {
+            size_t length = 0;
+            const char* name = directory.NameAt(i, &length);
+            UInt16 function_index = directory.name_ordinals[i];
+            
+            if (!name || function_index >= directory.number_of_functions) {
+                continue;
+            }
+            
+            entries.push_back(IndexFile::Entry{directory.names[i], static_cast<UInt32>(length), function_index});
+            hashes.push_back(SymbolHash::HashFast(name, length));
+        }
+        
+        UInt32 slot_count = 0;
+        if (!entries.empty()) {
+            slot_count = 8;
+            while (slot_count < entries.size() * 2) {
+                slot_count <<= 1;
+            }
+        }
+        
+        IndexFile::Header header{};
+        header.magic = IndexFile::kMagic;
+        header.version = IndexFile::kVersion;
+        header.header_size = sizeof(IndexFile::Header);
+        header.content_key = ExportIndexKey(directory, fingerprint);
+        header.image_size = fingerprint.image_size;
+        header.time_date_stamp = fingerprint.time_date_stamp;
+        header.checksum = fingerprint.checksum;
+        header.directory_rva = directory.directory_rva;
+        header.directory_size = directory.directory_size;
+        header.ordinal_base = directory.ordinal_base;
+        header.number_of_functions = directory.number_of_functions;
+        header.number_of_names = directory.number_of_names;
+        header.slot_count = slot_count;
+        header.entry_count = static_cast<UInt32>(entries.size());
+        header.slots_offset = sizeof(IndexFile::Header);
+        header.entries_offset = header.slots_offset + slot_count * sizeof(IndexFile::Slot);
+        header.ordinals_offset = header.entries_offset + header.entry_count * sizeof(IndexFile::Entry);
+        
+        UInt64 file_size = header.ordinals_offset + static_cast<UInt64>(directory.number_of_functions) * sizeof(UInt32);
+        if (file_size > 0xFFFFFFFFu) {
+            return false;
+        }
+        header.file_size = static_cast<UInt32>(file_size);
+        
+        // Буфер обнулён заранее: выравнивающих и неиспользуемых байтов с мусором нет
+        out.assign(header.file_size, 0);
+        memcpy(out.data(), &header, sizeof(header));
+        
+        auto* slots = reinterpret_cast<IndexFile::Slot*>(out.data() + header.slots_offset);
+        UInt32 mask = slot_count - 1;
+        for (UInt32 entry = 0; entry < header.entry_count; ++entry) {
+            UInt32 position = hashes[entry] & mask;
+            while (slots[position].entry != 0) {
+                position = (position + 1) & mask;
+            }
+            slots[position] = IndexFile::Slot{hashes[entry], entry + 1};
+        }
+        
+        if (!entries.empty()) {
+            memcpy(out.data() + header.entries_offset, entries.data(), entries.size() * sizeof(IndexFile::Entry));
+        }
+        
+        // Ординал -> первое имя функции
+        auto* ordinals = reinterpret_cast<UInt32*>(out.data() + header.ordinals_offset);
+        for (UInt32 entry = 0; entry < header.entry_count; ++entry) {
+            UInt32& first = ordinals[entries[entry].function_index];
+            if (first == 0) {
+                first = entry + 1;
+            }
+        }
+        
+        return true;
+        
+    } catch (...) {
+        out.clear();
+        return false;
+    }
+}
+
+// Проверка и подключение отображённого файла
+bool MappedExportIndex::Attach(const void* data, size_t size, const ExportDirectory& directory,
+                               const ImageFingerprint& fingerprint) noexcept {
+    Detach();
+    
+    if (!data || size < sizeof(IndexFile::Header) ||
+        reinterpret_cast<uintptr_t>(data) % alignof(IndexFile::Header) != 0) {
+        return false;
+    }
+    
+    const auto* header = static_cast<const IndexFile::Header*>(data);
+    const auto* bytes = static_cast<const UInt8*>(data);
+    
+    // Формат и привязка к образу
+    if (header->magic != IndexFile::kMagic || header->version != IndexFile::kVersion ||
+        header->header_size != sizeof(IndexFile::Header) || header->file_size != size ||
+        header->image_size != fingerprint.image_size ||
+        header->time_date_stamp != fingerprint.time_date_stamp ||
+        header->checksum != fingerprint.checksum ||
+        header->directory_rva != directory.directory_rva ||
+        header->directory_size != directory.directory_size ||
+        header->ordinal_base != directory.ordinal_base ||
+        header->number_of_functions != directory.number_of_functions ||
+        header->number_of_names != directory.number_of_names ||
+        header->entry_count > header->number_of_names) {
+        return false;
+    }
+    
+    if ((header->slot_count & (header->slot_count - 1)) != 0 ||
+        (header->entry_count != 0 && header->slot_count < header->entry_count * 2ull) ||
+        !IsArrayInFile<IndexFile::Slot>(header->slots_offset, header->slot_count, size) ||
+        !IsArrayInFile<IndexFile::Entry>(header->entries_offset, header->entry_count, size) ||
+        !IsArrayInFile<UInt32>(header->ordinals_offset, header->number_of_functions, size)) {
+        return false;
+    }
+    
+    if (header->content_key != ExportIndexKey(directory, fingerprint)) {
+        return false;
+    }
+    
+    // Границы записей: дальше поиск читает их без проверок
+    const auto* slots = reinterpret_cast<const IndexFile::Slot*>(bytes + header->slots_offset);
+    const auto* entries = reinterpret_cast<const IndexFile::Entry*>(bytes + header->entries_offset);
+    const auto* ordinals = reinterpret_cast<const UInt32*>(bytes + header->ordinals_offset);
+    
+    for (UInt32 i = 0; i < header->slot_count; ++i) {
+        if (slots[i].entry > header->entry_count) {
+            return false;
+        }
+    }
+    
+    for (UInt32 i = 0; i < header->entry_count; ++i) {
+        const IndexFile::Entry& entry = entries[i];
+        if (entry.function_index >= directory.number_of_functions ||
+            static_cast<UInt64>(entry.name_rva) + entry.name_length >= directory.image_size ||
+            directory.image_base[entry.name_rva + entry.name_length] != 0) {
+            return false;
+        }
+    }
+    
+    for (UInt32 i = 0; i < header->number_of_functions; ++i) {
+        if (ordinals[i] > header->entry_count) {
+            return false;
+        }
+    }
+    
+    header_ = header;
+    slots_ = slots;
+    entries_ = entries;
+    ordinals_ = ordinals;
+    directory_ = directory;
+    mask_ = header->slot_count - 1;
+    return true;
+}
+
+// Отключение
+void MappedExportIndex::Detach() noexcept {
+    header_ = nullptr;
+    slots_ = nullptr;
+    entries_ = nullptr;
+    ordinals_ = nullptr;
+    directory_ = ExportDirectory();
+    mask_ = 0;
+}
+
+// Поиск по ключу
+UInt32 MappedExportIndex::Find(const SymbolKey& key) const noexcept {
+    if (!header_ || header_->entry_count == 0 || !key.name) {
+        return kNotFound;
+    }
+    
+    UInt32 position = key.hash & mask_;
+    for (UInt32 probe = 0; probe < header_->slot_count; ++probe) {
+        const IndexFile::Slot& slot = slots_[position];
+        if (slot.entry == 0) {
+            break;
+        }
+        
+        if (slot.hash == key.hash) {
+            const IndexFile::Entry& entry = entries_[slot.entry - 1];
+            if (entry.name_length == key.length &&
+                memcmp(directory_.image_base + entry.name_rva, key.name, key.length) == 0) {
+                return entry.function_index;
+            }
+        }
+        
+        position = (position + 1) & mask_;
+    }
+    
+    return kNotFound;
+}
+
+UInt32 MappedExportIndex::Find(const char* name) const noexcept {
+    if (!name) {
+        return kNotFound;
+    }
+    
+    size_t length = strlen(name);
+    SymbolKey key(name, 0);
+    key.length = static_cast<UInt32>(length);
+    key.hash = SymbolHash::HashFast(name, length);
+    return Find(key);
+}
+
+// Имя функции по индексу
+const char* MappedExportIndex::NameOfFunction(UInt32 function_index, size_t* length) const noexcept {
+    if (!header_ || function_index >= header_->number_of_functions || ordinals_[function_index] == 0) {
+        return nullptr;
+    }
+    
+    const IndexFile::Entry& entry = entries_[ordinals_[function_index] - 1];
+    if (length) {
+        *length = entry.name_length;
+    }
+    return reinterpret_cast<const char*>(directory_.image_base) + entry.name_rva;
+}
+
+} // namespace MemoryModule
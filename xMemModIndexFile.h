@@ -0,0 +1,121 @@
+/**
+ * @file xMemModIndexFile.h
+ * @brief MemoryModule - Сохраняемый индекс экспортов для отображения в память
+ * @details Компактный файл с хеш-таблицей имён, таблицей ординалов и RVA имён
+ *          (без указателей), который несколько процессов отображают и читают
+ *          вместо построения ExportIndex. Формат версионирован, генерация
+ *          детерминирована. Не зависит от Windows SDK.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include "xMemModTypes.h"
+#include "xMemModExports.h"
+
+#include <vector>
+
+namespace MemoryModule {
+
+// Поля заголовков PE, по которым файл привязан к образу
+struct ImageFingerprint {
+    UInt32 image_size;       // SizeOfImage
+    UInt32 time_date_stamp;  // FileHeader.TimeDateStamp
+    UInt32 checksum;         // OptionalHeader.CheckSum
+};
+
+// Формат файла (little-endian, все смещения от начала файла):
+//   заголовок | слоты [slot_count] | записи [entry_count] | ординалы [number_of_functions]
+namespace IndexFile {
+    constexpr UInt32 kMagic = 0x58494D58u;  // "XMIX"
+    constexpr UInt16 kVersion = 1;
+
+    struct Header {
+        UInt32 magic;
+        UInt16 version;
+        UInt16 header_size;
+        UInt32 file_size;
+        UInt32 flags;                // Зарезервировано (0)
+        UInt64 content_key;          // ExportIndexKey() образа
+        UInt32 image_size;
+        UInt32 time_date_stamp;
+        UInt32 checksum;
+        UInt32 directory_rva;
+        UInt32 directory_size;
+        UInt32 ordinal_base;
+        UInt32 number_of_functions;
+        UInt32 number_of_names;
+        UInt32 slot_count;           // Степень двойки
+        UInt32 entry_count;
+        UInt32 slots_offset;
+        UInt32 entries_offset;
+        UInt32 ordinals_offset;
+    };
+
+    // Слот хеш-таблицы: хеш имени и номер записи + 1 (0 - пусто)
+    struct Slot {
+        UInt32 hash;
+        UInt32 entry;
+    };
+
+    // Запись имени: строка остаётся в образе, здесь только её RVA
+    struct Entry {
+        UInt32 name_rva;
+        UInt32 name_length;
+        UInt32 function_index;
+    };
+
+    static_assert(sizeof(Header) == 80, "IndexFile::Header layout");
+    static_assert(sizeof(Slot) == 8, "IndexFile::Slot layout");
+    static_assert(sizeof(Entry) == 12, "IndexFile::Entry layout");
+}
+
+// Ключ содержимого: CRC32C байтов каталога экспортов (с таблицами и строками,
+// если линкер разместил их в нём) вместе с полями заголовков. Годится как имя
+// файла в общем кэше: одинаковые образы дают одинаковый ключ.
+UInt64 ExportIndexKey(const ExportDirectory& directory, const ImageFingerprint& fingerprint) noexcept;
+
+// Генерация файла индекса. Результат зависит только от образа: таблица
+// заполняется последовательно в порядке AddressOfNames.
+bool BuildExportIndexFile(const ExportDirectory& directory, const ImageFingerprint& fingerprint,
+                          std::vector<UInt8>& out) noexcept;
+
+// Индекс поверх отображённого файла. Attach проверяет заголовок, ключ и
+// границы всех записей (линейный проход без хеширования имён); при любом
+// несовпадении возвращает false - тогда индекс строится обычным путём.
+// Файл должен оставаться отображённым, пока индекс подключён.
+class MappedExportIndex {
+public:
+    static constexpr UInt32 kNotFound = 0xFFFFFFFFu;
+
+    bool Attach(const void* data, size_t size, const ExportDirectory& directory,
+                const ImageFingerprint& fingerprint) noexcept;
+    void Detach() noexcept;
+    bool IsAttached() const noexcept { return header_ != nullptr; }
+
+    // Индекс функции (ordinal - Base) по имени или kNotFound
+    UInt32 Find(const SymbolKey& key) const noexcept;
+    UInt32 Find(const char* name) const noexcept;
+
+    // Имя функции по индексу (nullptr для экспорта без имени)
+    const char* NameOfFunction(UInt32 function_index, size_t* length = nullptr) const noexcept;
+
+    // Каталог, к которому привязан индекс
+    const ExportDirectory& Directory() const noexcept { return directory_; }
+    UInt32 Size() const noexcept { return header_ ? header_->entry_count : 0; }
+
+private:
+    const IndexFile::Header* header_ = nullptr;
+    const IndexFile::Slot* slots_ = nullptr;
+    const IndexFile::Entry* entries_ = nullptr;
+    const UInt32* ordinals_ = nullptr;
+    ExportDirectory directory_;
+    UInt32 mask_ = 0;
+};
+
+} // namespace MemoryModule
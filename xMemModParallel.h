@@ -0,0 +1,65 @@
+/**
+ * @file xMemModParallel.h
+ * @brief MemoryModule - Простое распараллеливание диапазонов на std::thread
+ * @details Используется при построении индекса экспортов и других тяжёлых
+ *          этапах загрузки. Не зависит от Windows SDK.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include "xMemModTypes.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace MemoryModule {
+
+// Число рабочих потоков по умолчанию: ядра процессора, но не больше limit
+inline size_t DefaultWorkerCount(size_t limit = 8) noexcept {
+    size_t cores = std::thread::hardware_concurrency();
+    return std::max<size_t>(1, std::min(cores, limit));
+}
+
+// Разбиение [0, count) на workers непересекающихся частей. fn(begin, end)
+// вызывается для каждой части; первую часть обрабатывает текущий поток.
+// fn не должна выбрасывать исключений. Если потоки создать не удалось,
+// уже запущенные дожидаются и исключение передаётся вызывающему.
+template <typename Function>
+void ParallelFor(size_t count, size_t workers, Function&& fn) {
+    workers = std::min(workers, count);
+    if (workers <= 1) {
+        fn(static_cast<size_t>(0), count);
+        return;
+    }
+
+    size_t chunk = (count + workers - 1) / workers;
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+
+    try {
+        for (size_t begin = chunk; begin < count; begin += chunk) {
+            size_t end = std::min(count, begin + chunk);
+            threads.emplace_back([&fn, begin, end]() { fn(begin, end); });
+        }
+    } catch (...) {
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        throw;
+    }
+
+    fn(static_cast<size_t>(0), std::min(chunk, count));
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace MemoryModule
@@ -0,0 +1,255 @@
+﻿/**
+ * @file xMemModReloc.cpp
+ * @brief MemoryModule - Реализация применения базовых релокаций
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModReloc.h"
+#include "xMemModParallel.h"
+#include "xMemModSimd.h"
+
+#include <atomic>
+#include <cstring>
+
+namespace MemoryModule {
+
+namespace {
+    constexpr size_t kBlockHeaderSize = 8;   // VirtualAddress + SizeOfBlock
+    
+    UInt32 ReadUInt32(const UInt8* data) noexcept {
+        UInt32 value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+    
+    // Чтение-изменение-запись значения произвольной ширины без требований к выравниванию
+    template <typename T>
+    void AddAt(UInt8* address, T delta) noexcept {
+        T value;
+        memcpy(&value, address, sizeof(T));
+        value = static_cast<T>(value + delta);
+        memcpy(address, &value, sizeof(T));
+    }
+    
+    // Группа плотного ядра и запас страницы: смещение до 0xFFF плюс 8 байт записи
+    constexpr UInt32 kDenseGroup = 16;
+    constexpr size_t kDensePageSpan = 0x1000 + 8;
+    
+    // Применение группы по уже разобранным смещениям - без ветвлений по типу
+    template <typename T>
+    void ApplyGroup(UInt8* page, const UInt16* offsets, T delta) noexcept {
+        for (UInt32 k = 0; k < kDenseGroup; k += 4) {
+            AddAt<T>(page + offsets[k], delta);
+            AddAt<T>(page + offsets[k + 1], delta);
+            AddAt<T>(page + offsets[k + 2], delta);
+            AddAt<T>(page + offsets[k + 3], delta);
+        }
+    }
+    
+#ifdef XMEMMOD_X86
+    // AVX2: 16 записей за раз; false - в группе есть другой тип
+    XMEMMOD_TARGET_AVX2
+    bool DecodeGroupAvx2(const UInt8* entries, UInt16 type, UInt16* offsets) noexcept {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(entries));
+        __m256i types = _mm256_srli_epi16(value, 12);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(types, _mm256_set1_epi16(static_cast<short>(type)))) != -1) {
+            return false;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(offsets),
+                            _mm256_and_si256(value, _mm256_set1_epi16(0x0FFF)));
+        return true;
+    }
+#endif
+    
+#ifdef XMEMMOD_SSE2
+    // SSE2: те же 16 записей двумя половинами
+    bool DecodeGroupSse2(const UInt8* entries, UInt16 type, UInt16* offsets) noexcept {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(entries));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(entries + 16));
+        __m128i expected = _mm_set1_epi16(static_cast<short>(type));
+        __m128i equal = _mm_and_si128(_mm_cmpeq_epi16(_mm_srli_epi16(low, 12), expected),
+                                      _mm_cmpeq_epi16(_mm_srli_epi16(high, 12), expected));
+        if (_mm_movemask_epi8(equal) != 0xFFFF) {
+            return false;
+        }
+        __m128i mask = _mm_set1_epi16(0x0FFF);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(offsets), _mm_and_si128(low, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(offsets + 8), _mm_and_si128(high, mask));
+        return true;
+    }
+#endif
+    
+    using DecodeGroup = bool (*)(const UInt8*, UInt16, UInt16*) noexcept;
+    
+    // Лучшее ядро разбора для текущего процессора (nullptr - только скалярно)
+    DecodeGroup SelectDecoder() noexcept {
+#ifdef XMEMMOD_X86
+        if (Cpu::GetFeatures().avx2) {
+            return DecodeGroupAvx2;
+        }
+#endif
+#ifdef XMEMMOD_SSE2
+        return DecodeGroupSse2;
+#else
+        return nullptr;
+#endif
+    }
+    
+    // Плотная часть блока: группы одного типа (по первой записи) подряд.
+    // Возвращает число обработанных записей - остаток идёт скалярно.
+    UInt32 ApplyDense(DecodeGroup decode, UInt8* page, const UInt8* entries, UInt32 count, UInt64 delta) noexcept {
+        UInt16 first;
+        memcpy(&first, entries, sizeof(first));
+        UInt16 type = first >> 12;
+        if (type != RelocationType::kDir64 && type != RelocationType::kHighLow) {
+            return 0;
+        }
+        
+        alignas(32) UInt16 offsets[kDenseGroup];
+        UInt32 done = 0;
+        for (; count - done >= kDenseGroup; done += kDenseGroup) {
+            if (!decode(entries + done * 2, type, offsets)) {
+                break;
+            }
+            if (type == RelocationType::kDir64) {
+                ApplyGroup<UInt64>(page, offsets, delta);
+            } else {
+                ApplyGroup<UInt32>(page, offsets, static_cast<UInt32>(delta));
+            }
+        }
+        return done;
+    }
+}
+
+// Разбор границ блоков
+bool IndexRelocationBlocks(const UInt8* table, size_t size, std::vector<RelocationBlock>& blocks) noexcept {
+    try {
+        blocks.clear();
+        
+        size_t offset = 0;
+        while (size - offset >= kBlockHeaderSize) {
+            UInt32 page_rva = ReadUInt32(table + offset);
+            UInt32 block_size = ReadUInt32(table + offset + 4);
+            
+            // Нулевой блок в конце - выравнивание каталога
+            if (page_rva == 0 && block_size == 0) {
+                break;
+            }
+            
+            if (block_size < kBlockHeaderSize || (block_size & 1) != 0 || block_size > size - offset) {
+                return false;
+            }
+            
+            blocks.push_back(RelocationBlock{page_rva, static_cast<UInt32>(offset + kBlockHeaderSize),
+                                             (block_size - static_cast<UInt32>(kBlockHeaderSize)) / 2});
+            offset += block_size;
+        }
+        
+        return true;
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+// Применение блоков
+bool ApplyRelocationBlocks(UInt8* image, size_t image_size, const UInt8* table,
+                           const RelocationBlock* blocks, size_t count, UInt64 delta,
+                           bool vectorized) noexcept {
+    DecodeGroup decode = vectorized ? SelectDecoder() : nullptr;
+    
+    for (size_t i = 0; i < count; ++i) {
+        const RelocationBlock& block = blocks[i];
+        const UInt8* entries = table + block.entries_offset;
+        
+        // Плотное ядро - только если вся страница с запасом внутри образа
+        UInt32 j = 0;
+        if (decode && block.count >= kDenseGroup && block.page_rva <= image_size &&
+            image_size - block.page_rva >= kDensePageSpan) {
+            j = ApplyDense(decode, image + block.page_rva, entries, block.count, delta);
+        }
+        
+        for (; j < block.count; ++j) {
+            UInt16 entry;
+            memcpy(&entry, entries + j * 2, sizeof(entry));
+            
+            UInt16 type = entry >> 12;
+            if (type == RelocationType::kAbsolute) {
+                continue;
+            }
+            
+            size_t rva = static_cast<size_t>(block.page_rva) + (entry & 0xFFF);
+            size_t width = type == RelocationType::kDir64 ? 8 : (type == RelocationType::kHighLow ? 4 : 2);
+            if (rva > image_size || image_size - rva < width) {
+                return false;
+            }
+            
+            UInt8* address = image + rva;
+            switch (type) {
+                case RelocationType::kDir64:
+                    AddAt<UInt64>(address, delta);
+                    break;
+                case RelocationType::kHighLow:
+                    AddAt<UInt32>(address, static_cast<UInt32>(delta));
+                    break;
+                case RelocationType::kHigh:
+                    AddAt<UInt16>(address, static_cast<UInt16>(delta >> 16));
+                    break;
+                case RelocationType::kLow:
+                    AddAt<UInt16>(address, static_cast<UInt16>(delta));
+                    break;
+                default:
+                    return false;
+            }
+        }
+    }
+    
+    return true;
+}
+
+// Разбор и применение: блоки независимы (каждый - своя страница)
+bool ApplyRelocations(UInt8* image, size_t image_size, UInt32 table_rva, UInt32 table_size,
+                      UInt64 delta, const RelocationOptions& options) noexcept {
+    if (delta == 0 || table_size == 0) {
+        return true;
+    }
+    if (table_rva > image_size || image_size - table_rva < table_size) {
+        return false;
+    }
+    
+    try {
+        const UInt8* table = image + table_rva;
+        
+        std::vector<RelocationBlock> blocks;
+        if (!IndexRelocationBlocks(table, table_size, blocks)) {
+            return false;
+        }
+        
+        size_t workers = options.max_workers != 0 ? options.max_workers : DefaultWorkerCount();
+        if (workers <= 1 || blocks.size() < options.parallel_min_blocks) {
+            return ApplyRelocationBlocks(image, image_size, table, blocks.data(), blocks.size(), delta,
+                                         options.vectorized);
+        }
+        
+        // Ошибка в любом потоке отменяет загрузку; применённое частично
+        // остаётся, как и при последовательном проходе
+        std::atomic<bool> ok(true);
+        ParallelFor(blocks.size(), workers, [&](size_t begin, size_t end) {
+            if (!ApplyRelocationBlocks(image, image_size, table, blocks.data() + begin, end - begin, delta,
+                                       options.vectorized)) {
+                ok.store(false, std::memory_order_relaxed);
+            }
+        });
+        return ok.load(std::memory_order_relaxed);
+        
+    } catch (...) {
+        return false;
+    }
+}
+
+} // namespace MemoryModule
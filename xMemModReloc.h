@@ -0,0 +1,64 @@
+/**
+ * @file xMemModReloc.h
+ * @brief MemoryModule - Применение базовых релокаций PE
+ * @details Таблица .reloc сначала разбирается на блоки (по одному на страницу
+ *          образа), затем блоки применяются независимо - при большом их числе
+ *          на нескольких потоках. Плотные блоки DIR64/HIGHLOW разбираются
+ *          SIMD-ядром (AVX2/SSE2) по 16 записей. Работает с обычным буфером
+ *          образа и не зависит от Windows SDK.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include "xMemModTypes.h"
+
+#include <vector>
+
+namespace MemoryModule {
+
+// Типы записей релокаций (как IMAGE_REL_BASED_*)
+namespace RelocationType {
+    constexpr UInt16 kAbsolute = 0;   // Выравнивание блока, пропускается
+    constexpr UInt16 kHigh = 1;
+    constexpr UInt16 kLow = 2;
+    constexpr UInt16 kHighLow = 3;
+    constexpr UInt16 kDir64 = 10;
+}
+
+// Блок таблицы релокаций: записи одной страницы образа
+struct RelocationBlock {
+    UInt32 page_rva;        // RVA страницы
+    UInt32 entries_offset;  // Смещение первой записи от начала таблицы
+    UInt32 count;           // Число 16-битных записей
+};
+
+// Настройки применения релокаций
+struct RelocationOptions {
+    size_t parallel_min_blocks = 512;   // Меньше блоков - в текущем потоке
+    size_t max_workers = 0;             // 0 - DefaultWorkerCount(); 1 - без потоков
+    bool vectorized = true;             // SIMD-ядро для плотных блоков одного типа
+};
+
+// Разбор границ блоков. false - таблица повреждена (размер блока меньше
+// заголовка, нечётный или выходит за таблицу).
+bool IndexRelocationBlocks(const UInt8* table, size_t size, std::vector<RelocationBlock>& blocks) noexcept;
+
+// Применение блоков к образу; delta - разница баз по модулю 2^64.
+// false - запись выходит за образ или тип записи не поддерживается.
+// vectorized: группы по 16 записей DIR64 (или HIGHLOW) разбираются SIMD,
+// с первой смешанной группы блок дорабатывается скалярно.
+bool ApplyRelocationBlocks(UInt8* image, size_t image_size, const UInt8* table,
+                           const RelocationBlock* blocks, size_t count, UInt64 delta,
+                           bool vectorized = true) noexcept;
+
+// Разбор и применение таблицы, лежащей в образе по table_rva
+bool ApplyRelocations(UInt8* image, size_t image_size, UInt32 table_rva, UInt32 table_size,
+                      UInt64 delta, const RelocationOptions& options) noexcept;
+
+} // namespace MemoryModule
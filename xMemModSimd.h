@@ -0,0 +1,111 @@
+/**
+ * @file xMemModSimd.h
+ * @brief MemoryModule - Определение возможностей процессора для SIMD-путей
+ * @details Проверка SSE4.2/AVX2 через CPUID (один раз на процесс) и макросы
+ *          для функций, собранных под конкретный набор инструкций.
+ *          Не зависит от Windows SDK.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include "xMemModTypes.h"
+
+// Архитектура x86/x64 - единственная, где есть SIMD-пути
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define XMEMMOD_X86 1
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define XMEMMOD_X64 1
+#endif
+
+// SSE2 есть всегда на x64 и на x86 при соответствующих флагах компиляции
+#if defined(XMEMMOD_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define XMEMMOD_SSE2 1
+#endif
+
+#ifdef XMEMMOD_X86
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        // MSVC разрешает интринсики без флагов компиляции
+        #define XMEMMOD_TARGET_SSE42
+        #define XMEMMOD_TARGET_AVX2
+    #else
+        #include <cpuid.h>
+        #define XMEMMOD_TARGET_SSE42 __attribute__((target("sse4.2")))
+        #define XMEMMOD_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+    #include <immintrin.h>
+#endif
+
+namespace MemoryModule {
+namespace Cpu {
+
+// Возможности процессора
+struct Features {
+    bool sse42 = false;
+    bool avx2 = false;
+};
+
+namespace Detail {
+#ifdef XMEMMOD_X86
+    inline void CpuId(int leaf, int subleaf, unsigned registers[4]) noexcept {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuidex(info, leaf, subleaf);
+        for (int i = 0; i < 4; ++i) {
+            registers[i] = static_cast<unsigned>(info[i]);
+        }
+    #else
+        __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+    #endif
+    }
+
+    inline UInt64 ReadXcr0() noexcept {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        return _xgetbv(0);
+    #else
+        unsigned low = 0;
+        unsigned high = 0;
+        __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+        return (static_cast<UInt64>(high) << 32) | low;
+    #endif
+    }
+#endif
+
+    inline Features Detect() noexcept {
+        Features features;
+#ifdef XMEMMOD_X86
+        unsigned registers[4] = {0, 0, 0, 0};
+        CpuId(0, 0, registers);
+        unsigned max_leaf = registers[0];
+
+        CpuId(1, 0, registers);
+        features.sse42 = (registers[2] & (1u << 20)) != 0;
+        bool osxsave = (registers[2] & (1u << 27)) != 0;
+        bool avx = (registers[2] & (1u << 28)) != 0;
+
+        // AVX2 годится только если ОС сохраняет YMM-регистры
+        if (max_leaf >= 7 && osxsave && avx && (ReadXcr0() & 0x6) == 0x6) {
+            CpuId(7, 0, registers);
+            features.avx2 = (registers[1] & (1u << 5)) != 0;
+        }
+#endif
+        return features;
+    }
+}
+
+// Возможности текущего процессора (определяются один раз)
+inline const Features& GetFeatures() noexcept {
+    static const Features features = Detail::Detect();
+    return features;
+}
+
+} // namespace Cpu
+} // namespace MemoryModule
@@ -0,0 +1,200 @@
+﻿/**
+ * @file xMemModThunks.cpp
+ * @brief MemoryModule - Генерация переходников со счётчиками вызовов
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#include "xMemModThunks.h"
+
+#include <cstring>
+#include <initializer_list>
+#include <new>
+
+namespace MemoryModule {
+
+namespace {
+    constexpr UInt8 kInt3 = 0xCC;
+    
+    // Поток байтов машинного кода
+    class Emitter {
+    public:
+        explicit Emitter(UInt8* code) noexcept : code_(code) {}
+        
+        void Bytes(std::initializer_list<UInt8> bytes) noexcept {
+            for (UInt8 byte : bytes) {
+                *code_++ = byte;
+            }
+        }
+        
+        void UInt32Le(UInt32 value) noexcept {
+            memcpy(code_, &value, sizeof(value));
+            code_ += sizeof(value);
+        }
+        
+        // disp32 до target относительно конца инструкции (disp32 - её последнее поле)
+        void RipDisp(const void* target) noexcept {
+            auto next = reinterpret_cast<intptr_t>(code_) + 4;
+            UInt32Le(static_cast<UInt32>(reinterpret_cast<intptr_t>(target) - next));
+        }
+        
+    private:
+        UInt8* code_;
+    };
+    
+    // x64 (аргументы в rcx/rdx/r8/r9 или rdi/rsi/...; r10/r11 свободны в обоих ABI)
+    void EmitThunkX64(Emitter& out, const std::atomic<UInt64>* counter, const void* const* target,
+                      UInt32 stripe_stride) noexcept {
+        out.Bytes({0x49, 0x89, 0xE3});                      // mov   r11, rsp
+        out.Bytes({0x49, 0xC1, 0xEB,                         // shr   r11, kStripeShift
+                   static_cast<UInt8>(CallCounters::kStripeShift)});
+        out.Bytes({0x41, 0x83, 0xE3,                         // and   r11d, kStripes - 1
+                   static_cast<UInt8>(CallCounters::kStripes - 1)});
+        out.Bytes({0x4D, 0x69, 0xDB});                      // imul  r11, r11, stride
+        out.UInt32Le(stripe_stride);
+        out.Bytes({0x4C, 0x8D, 0x15});                      // lea   r10, [rip + counter]
+        out.RipDisp(counter);
+        out.Bytes({0xF0, 0x4B, 0xFF, 0x04, 0x1A});          // lock inc qword [r10 + r11]
+        out.Bytes({0xFF, 0x25});                            // jmp   qword [rip + target]
+        out.RipDisp(target);
+    }
+    
+    // x86. Аргументы бывают в eax/ecx/edx (register, regparm, fastcall), поэтому
+    // все используемые регистры сохраняются и восстанавливаются до перехода -
+    // стек на jmp тот же, что на входе. 64-битный счётчик увеличивается одной
+    // lock cmpxchg8b: читатель никогда не видит половину переноса.
+    void EmitThunkX86(Emitter& out, const std::atomic<UInt64>* counter, const void* const* target,
+                      UInt32 stripe_stride) noexcept {
+        auto low = static_cast<UInt32>(reinterpret_cast<uintptr_t>(counter));
+        
+        out.Bytes({0x50, 0x53, 0x51, 0x52, 0x56});          // push  eax, ebx, ecx, edx, esi
+        out.Bytes({0x89, 0xE6});                            // mov   esi, esp
+        out.Bytes({0xC1, 0xEE,                               // shr   esi, kStripeShift
+                   static_cast<UInt8>(CallCounters::kStripeShift)});
+        out.Bytes({0x83, 0xE6,                               // and   esi, kStripes - 1
+                   static_cast<UInt8>(CallCounters::kStripes - 1)});
+        out.Bytes({0x69, 0xF6});                            // imul  esi, esi, stride
+        out.UInt32Le(stripe_stride);
+        out.Bytes({0x81, 0xC6});                            // add   esi, counter
+        out.UInt32Le(low);
+        out.Bytes({0x8B, 0x06});                            // mov   eax, [esi]
+        out.Bytes({0x8B, 0x56, 0x04});                      // mov   edx, [esi + 4]
+        out.Bytes({0x89, 0xC3});                            // retry: mov ebx, eax
+        out.Bytes({0x89, 0xD1});                            // mov   ecx, edx
+        out.Bytes({0x83, 0xC3, 0x01});                      // add   ebx, 1
+        out.Bytes({0x83, 0xD1, 0x00});                      // adc   ecx, 0
+        out.Bytes({0xF0, 0x0F, 0xC7, 0x0E});                // lock cmpxchg8b qword [esi]
+        out.Bytes({0x75, 0xF0});                            // jnz   retry (edx:eax - свежее значение)
+        out.Bytes({0x5E, 0x5A, 0x59, 0x5B, 0x58});          // pop   esi, edx, ecx, ebx, eax
+        out.Bytes({0xFF, 0x25});                            // jmp   dword [target]
+        out.UInt32Le(static_cast<UInt32>(reinterpret_cast<uintptr_t>(target)));
+    }
+    
+    size_t AlignUp(size_t value, size_t alignment) noexcept {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+// Размер кода (до границы страницы, чтобы защитить его отдельно от данных)
+size_t CallCounters::CodeSize(size_t count, size_t page_size) noexcept {
+    return AlignUp(count * kThunkSize, page_size ? page_size : 4096);
+}
+
+// Полный размер блока
+size_t CallCounters::RequiredSize(size_t count, size_t page_size) noexcept {
+    size_t targets = AlignUp(count * sizeof(void*), 64);
+    size_t counters = kStripes * AlignUp(count * sizeof(UInt64), 64);
+    return CodeSize(count, page_size) + targets + counters;
+}
+
+// Генерация переходников
+bool CallCounters::Build(void* memory, size_t size, size_t page_size, const void* const* targets,
+                         size_t count, ThunkArch arch) noexcept {
+    Clear();
+    
+    if (!memory || !targets || count == 0 || size < RequiredSize(count, page_size)) {
+        return false;
+    }
+    
+    // Шаг полосы - целое число строк кэша: полосы не делят строки
+    size_t stride = AlignUp(count * sizeof(UInt64), 64);
+    if (stride * (kStripes - 1) > 0x7FFFFFFFu) {
+        return false;
+    }
+    
+    auto* base = static_cast<UInt8*>(memory);
+    auto* code = base;
+    auto* target_slots = reinterpret_cast<const void**>(base + CodeSize(count, page_size));
+    auto* counters = reinterpret_cast<std::atomic<UInt64>*>(
+        reinterpret_cast<UInt8*>(target_slots) + AlignUp(count * sizeof(void*), 64));
+    
+    for (size_t i = 0; i < kStripes * stride / sizeof(UInt64); ++i) {
+        new (&counters[i]) std::atomic<UInt64>(0);
+    }
+    
+    memset(code, kInt3, CodeSize(count, page_size));
+    
+    for (size_t i = 0; i < count; ++i) {
+        target_slots[i] = targets[i];
+        if (!targets[i]) {
+            continue;
+        }
+        
+        Emitter out(code + i * kThunkSize);
+        if (arch == ThunkArch::X64) {
+            EmitThunkX64(out, &counters[i], &target_slots[i], static_cast<UInt32>(stride));
+        } else {
+            EmitThunkX86(out, &counters[i], &target_slots[i], static_cast<UInt32>(stride));
+        }
+    }
+    
+    code_ = code;
+    targets_ = target_slots;
+    counters_ = counters;
+    count_ = count;
+    return true;
+}
+
+// Отключение (память освобождает вызывающий)
+void CallCounters::Clear() noexcept {
+    code_ = nullptr;
+    targets_ = nullptr;
+    counters_ = nullptr;
+    count_ = 0;
+}
+
+// Адрес переходника
+const void* CallCounters::ThunkAt(size_t index) const noexcept {
+    if (index >= count_ || !targets_[index]) {
+        return nullptr;
+    }
+    return code_ + index * kThunkSize;
+}
+
+// Сумма по полосам
+UInt64 CallCounters::CountAt(size_t index) const noexcept {
+    if (index >= count_) {
+        return 0;
+    }
+    
+    size_t stride = AlignUp(count_ * sizeof(UInt64), 64) / sizeof(UInt64);
+    UInt64 total = 0;
+    for (size_t stripe = 0; stripe < kStripes; ++stripe) {
+        total += counters_[stripe * stride + index].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+// Сброс всех счётчиков
+void CallCounters::Reset() noexcept {
+    size_t stride = AlignUp(count_ * sizeof(UInt64), 64) / sizeof(UInt64);
+    for (size_t i = 0; i < kStripes * stride; ++i) {
+        counters_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace MemoryModule
@@ -0,0 +1,72 @@
+/**
+ * @file xMemModThunks.h
+ * @brief MemoryModule - Переходники со счётчиками вызовов экспортов
+ * @details Для каждого экспорта генерируется короткий машинный переходник:
+ *          атомарный инкремент счётчика и переход на настоящую функцию
+ *          (jmp без своего кадра, поэтому аргументы, возвращаемое значение
+ *          и раскрутка стека при исключениях не затрагиваются). Счётчики
+ *          разнесены по полосам, полоса выбирается по адресу стека потока,
+ *          чтобы потоки не делили одну строку кэша. Счётчики 64-битные:
+ *          на x64 - lock inc, на x86 - цикл lock cmpxchg8b с сохранением
+ *          регистров (аргументы в eax/ecx/edx не портятся). Генерация кода x86/x64
+ *          не зависит от Windows SDK; память выделяет вызывающий.
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include "xMemModTypes.h"
+
+#include <atomic>
+
+namespace MemoryModule {
+
+// Архитектура генерируемого кода
+enum class ThunkArch : UInt8 {
+    X86,
+    X64
+};
+
+// Переходники со счётчиками вызовов. Раскладка блока памяти:
+//   [код переходников][до границы страницы][адреса целей][счётчики по полосам]
+// Код после Build() переводится вызывающим в режим чтения и исполнения
+// (CodeSize() байт от начала), остальное остаётся доступным для записи.
+class CallCounters {
+public:
+    static constexpr size_t kStripes = 8;       // Полосы счётчиков
+    static constexpr size_t kStripeShift = 20;  // Полоса = (SP >> 20) & 7: стеки потоков разнесены на мегабайты
+    static constexpr size_t kThunkSize = 64;
+
+    // Размеры блока для count переходников
+    static size_t CodeSize(size_t count, size_t page_size) noexcept;
+    static size_t RequiredSize(size_t count, size_t page_size) noexcept;
+
+    // Генерация в выделенный вызывающим блок (RW). targets[i] == nullptr -
+    // переходник для i не создаётся (ThunkAt вернёт nullptr).
+    bool Build(void* memory, size_t size, size_t page_size, const void* const* targets,
+               size_t count, ThunkArch arch) noexcept;
+    void Clear() noexcept;
+
+    bool Empty() const noexcept { return count_ == 0; }
+    size_t Size() const noexcept { return count_; }
+
+    // Адрес переходника i (nullptr, если его нет)
+    const void* ThunkAt(size_t index) const noexcept;
+
+    // Число вызовов через переходник i (сумма по полосам) и сброс
+    UInt64 CountAt(size_t index) const noexcept;
+    void Reset() noexcept;
+
+private:
+    UInt8* code_ = nullptr;
+    const void** targets_ = nullptr;
+    std::atomic<UInt64>* counters_ = nullptr;
+    size_t count_ = 0;
+};
+
+} // namespace MemoryModule
@@ -0,0 +1,37 @@
+/**
+ * @file xMemModTypes.h
+ * @brief MemoryModule - Общие переносимые типы библиотеки
+ * @details Не зависит от Windows SDK, подключается как из xMemMod.h,
+ *          так и из платформонезависимых модулей (индекс экспортов и т.д.)
+ * @author ︻┻┳══━一 Pl∀tonシ
+ * @version 2.0.0
+ * @date 2025
+ *
+ * @license MIT License
+ * @copyright Copyright (c) 2025 ︻┻┳══━一 Pl∀tonシ
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Подсказка процессору заранее подтянуть строку кэша
+#if defined(__GNUC__) || defined(__clang__)
+    #define XMEMMOD_PREFETCH(address) __builtin_prefetch(address)
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    #include <xmmintrin.h>
+    #define XMEMMOD_PREFETCH(address) _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#else
+    #define XMEMMOD_PREFETCH(address) ((void)(address))
+#endif
+
+namespace MemoryModule {
+
+// Portable integer types
+using UInt8 = std::uint8_t;
+using UInt16 = std::uint16_t;
+using UInt32 = std::uint32_t;
+using UInt64 = std::uint64_t;
+
+} // namespace MemoryModule